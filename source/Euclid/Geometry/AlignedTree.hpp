@@ -10,11 +10,18 @@
 #ifndef _EUCLID_GEOMETRY_ALIGNED_TREE_H
 #define _EUCLID_GEOMETRY_ALIGNED_TREE_H
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ratio>
+#include <deque>
 #include <vector>
 #include <set>
+#include <type_traits>
 
 #include "../Numerics/Vector.hpp"
 #include "AlignedBox.hpp"
+#include "Line.hpp"
 
 namespace Euclid {
 	namespace Geometry {
@@ -31,6 +38,9 @@ namespace Euclid {
 		public:
 			enum { Q = 4, D = 2, R = 16 };
 
+			// The factor by which the bounds of each partition are enlarged, see Loose.
+			static constexpr RealT LOOSENESS = 1;
+
 			typedef Vector<D> VecT;
 			typedef AlignedBox<D> SpaceT;
 
@@ -58,6 +68,9 @@ namespace Euclid {
 		public:
 			enum { Q = 8, D = 3, R = 16 };
 
+			// The factor by which the bounds of each partition are enlarged, see Loose.
+			static constexpr RealT LOOSENESS = 1;
+
 			typedef Vector<D> VecT;
 			typedef AlignedBox<D> SpaceT;
 
@@ -84,84 +97,197 @@ namespace Euclid {
 			static PartitionLocation location_for_direction (const Direction &dir);
 		};
 
-		// An aligned space partitioning tree.
-		template <typename _TraitsT, typename ObjectT>
+		// Traits for a loose tree, where the bounds of each partition are enlarged by a factor of LoosenessT, e.g. AlignedTree<Loose<Octants>, ObjectT> is a loose octree. An object is kept in the partition containing its center, at the deepest level where it fits in the enlarged bounds, so its depth only depends on its size, and objects which straddle the planes between partitions don't accumulate near the top. Queries visit more partitions, since their bounds overlap.
+		template <typename BaseTraitsT, typename LoosenessT = std::ratio<2>>
+		class Loose : public BaseTraitsT {
+		public:
+			static_assert(LoosenessT::num > LoosenessT::den, "The looseness must be greater than one!");
+
+			static constexpr RealT LOOSENESS = RealT(LoosenessT::num) / RealT(LoosenessT::den);
+		};
+
+		// Give an object to a query callback, which can return false to stop the query, or nothing to continue. Returns whether the query should continue.
+		template <typename CallbackT, typename ObjectT>
+		inline bool accept_query_result (CallbackT & callback, const ObjectT & object) {
+			if constexpr (std::is_void<decltype(callback(object))>::value) {
+				callback(object);
+				return true;
+			} else {
+				return callback(object);
+			}
+		}
+
+		// Keeps the objects of each partition in a std::set, so they are ordered and each object is only stored once. Every object is a separate allocation.
+		template <typename ObjectT>
+		struct OrderedStorage {
+			typedef std::set<ObjectT> ObjectSetT;
+
+			static bool insert (ObjectSetT & objects, const ObjectT & object) {
+				return objects.insert(object).second;
+			}
+
+			static void append (ObjectSetT & objects, const ObjectT & object) {
+				objects.insert(objects.end(), object);
+			}
+
+			static bool erase (ObjectSetT & objects, const ObjectT & object) {
+				return objects.erase(object) != 0;
+			}
+		};
+
+		// Keeps the objects of each partition in a std::vector, which is contiguous and only allocates when it grows. Partitions are small (see TraitsT::R), so a linear search is faster than a tree. Objects only need operator==, and erasing an object moves the last object into its place, so the order is not kept.
+		template <typename ObjectT>
+		struct ContiguousStorage {
+			typedef std::vector<ObjectT> ObjectSetT;
+
+			static bool insert (ObjectSetT & objects, const ObjectT & object) {
+				if (std::find(objects.begin(), objects.end(), object) != objects.end()) return false;
+
+				objects.push_back(object);
+
+				return true;
+			}
+
+			// Add an object which isn't in the set already, e.g. when collecting the objects of different partitions.
+			static void append (ObjectSetT & objects, const ObjectT & object) {
+				objects.push_back(object);
+			}
+
+			static bool erase (ObjectSetT & objects, const ObjectT & object) {
+				auto i = std::find(objects.begin(), objects.end(), object);
+
+				if (i == objects.end()) return false;
+
+				*i = std::move(objects.back());
+				objects.pop_back();
+
+				return true;
+			}
+		};
+
+		// An aligned space partitioning tree. The partitions are allocated Q at a time, so that siblings are contiguous, and only store their level and integer coordinates, from which their origin and size are computed.
+		template <typename _TraitsT, typename ObjectT, typename StorageT = OrderedStorage<ObjectT>>
 		class AlignedTree {
 		public:
 			typedef _TraitsT TraitsT;
 			typedef typename TraitsT::VecT VecT;
 			typedef typename TraitsT::SpaceT SpaceT;
-			typedef std::set<ObjectT> ObjectSetT;
+			typedef typename StorageT::ObjectSetT ObjectSetT;
+
+			// The coordinates of a partition in units of its own size, relative to the origin of the tree.
+			typedef Vector<TraitsT::D, std::uint32_t> CellT;
+
+			// The partitions are subdivided at most this many times, so that the coordinates of each partition fit in CellT.
+			static constexpr unsigned MAXIMUM_LEVEL = 31;
+
+			// When erasing leaves a partition and its descendants with at most this many objects, they are coalesced into it. This is well below TraitsT::R, where a partition is redistributed, so that inserting and erasing a few objects doesn't repeatedly split and coalesce the same partition.
+			static constexpr std::size_t COALESCE_THRESHOLD = TraitsT::R / 2;
 
 			class Partition
 			{
 			protected:
-				ObjectSetT _objects;
+				friend class AlignedTree;
 
-				AlignedTree* _base;
-				typename TraitsT::PartitionLocation _location;
+				ObjectSetT _objects;
 
-				Partition* _parent;
-				Partition* _children[TraitsT::Q];
+				AlignedTree* _tree = nullptr;
 
-				VecT _origin;
-				VecT _size;
-				unsigned _level;
+				Partition* _parent = nullptr;
+				// The Q children, which are allocated together, or null.
+				Partition* _children = nullptr;
 
-				void compute_position () {
-					_origin = _parent->origin() + (TraitsT::normal_origin_for_partition_index(_location) * _parent->size());
-					_size = _parent->size() / 2;
-					_level = _parent->level() + 1;
-				}
+				CellT _cell = ZERO;
+				unsigned _level = 0;
 
-			public:
-				Partition (AlignedTree * base, const VecT & origin, const VecT & size) : _origin(origin), _size(size), _level(0)
-				{
-					_parent = NULL;
-					_location = (typename TraitsT::PartitionLocation) 0;
-					_base = base;
+				// The number of objects in this partition and its descendants.
+				std::size_t _total = 0;
 
-					std::fill_n(_children, (std::size_t)TraitsT::Q, nullptr);
+				void attach (AlignedTree * tree, Partition * parent, const CellT & cell, unsigned level) {
+					_tree = tree;
+					_parent = parent;
+					_children = nullptr;
+					_cell = cell;
+					_level = level;
+					_total = 0;
 				}
 
-				Partition (Partition *parent, typename TraitsT::PartitionLocation location) : _location(location), _parent(parent)
-				{
-					assert(_parent->_children[_location] == NULL);
+				// Add to the total of this partition and its parents.
+				void add_to_total (std::ptrdiff_t count) {
+					for (Partition * cur = this; cur != NULL; cur = cur->_parent)
+						cur->_total += count;
+				}
 
-					_parent->_children[_location] = this;
-					_base = parent->_base;
+			public:
+				Partition () {}
 
-					std::fill_n(_children, (std::size_t)TraitsT::Q, nullptr);
+				Partition (const Partition &) = delete;
+				Partition & operator= (const Partition &) = delete;
 
-					compute_position();
-				}
+				VecT origin () const {
+					VecT size = this->size(), origin = _tree->_origin;
 
-				~Partition () {
-					for (unsigned i = 0; i < TraitsT::Q; i += 1)
-						if (_children[i])
-							delete _children[i];
-				}
+					for (dimension i = 0; i < TraitsT::D; i += 1)
+						origin[i] += _cell[i] * size[i];
 
-				VecT origin () const {
-					return _origin;
+					return origin;
 				}
 
 				VecT size () const {
-					return _size;
+					return _tree->_size / (RealT)(std::uint32_t(1) << _level);
 				}
 
 				SpaceT bounding_box() const {
-					return SpaceT(_origin, _origin + _size);
+					VecT origin = this->origin();
+
+					return SpaceT(origin, origin + size());
+				}
+
+				// The bounds which contain all objects in this partition and its children, which are larger than the bounding box if the traits are Loose.
+				SpaceT loose_bounding_box() const {
+					VecT origin = this->origin(), size = this->size();
+
+					if (TraitsT::LOOSENESS == 1)
+						return SpaceT(origin, origin + size);
+
+					VecT margin = size * ((TraitsT::LOOSENESS - 1) / 2);
+
+					return SpaceT(origin - margin, origin + size + margin);
 				}
 
 				unsigned level () const {
 					return _level;
 				}
 
+				// The number of objects in this partition and its descendants.
+				std::size_t total_objects () const {
+					return _total;
+				}
+
+				// Whether the range of cells at MAXIMUM_LEVEL is inside this partition.
+				bool contains_cells (const CellT & first, const CellT & last) const {
+					unsigned shift = MAXIMUM_LEVEL - _level;
+
+					for (dimension i = 0; i < TraitsT::D; i += 1)
+						if ((first[i] >> shift) != _cell[i] || (last[i] >> shift) != _cell[i])
+							return false;
+
+					return true;
+				}
+
+				// The index of this partition in its parent, which is given by the lowest bit of each coordinate.
+				typename TraitsT::PartitionLocation location () const {
+					unsigned location = 0;
+
+					for (dimension i = 0; i < TraitsT::D; i += 1)
+						location |= (_cell[i] & 1) << i;
+
+					return (typename TraitsT::PartitionLocation)location;
+				}
+
 			public:
 				// Returns a given child partition.
-				Partition* child (unsigned i) { return _children[i]; }
-				const Partition* child (unsigned i) const { return _children[i]; }
+				Partition* child (unsigned i) { return _children ? _children + i : nullptr; }
+				const Partition* child (unsigned i) const { return _children ? _children + i : nullptr; }
 
 				// Returns the parent partition.
 				Partition* parent () { return _parent; }
@@ -186,9 +312,9 @@ namespace Euclid {
 				// Visitor pattern.
 				template <typename VisitorT>
 				void visit (VisitorT & visitor) {
-					for (unsigned i = 0; i < TraitsT::Q; i++) {
-						if (_children[i] != NULL) {
-							_children[i]->visit(visitor);
+					if (_children) {
+						for (unsigned i = 0; i < TraitsT::Q; i++) {
+							_children[i].visit(visitor);
 						}
 					}
 
@@ -198,22 +324,44 @@ namespace Euclid {
 				// Core function to redistribute objects into children subdivisions if possible.
 				// Can potentially take a long time to execute. O(QN)
 				void redistribute () {
-					for (unsigned i = 0; i < TraitsT::Q; i += 1) {
-						if (_children[i] == NULL) new Partition(this, (typename TraitsT::PartitionLocation)i);
+					if (_children == nullptr) {
+						if (_level >= MAXIMUM_LEVEL) return;
+
+						_children = _tree->allocate_children(this);
 					}
 
 					ObjectSetT resort;
 					std::swap(_objects, resort);
 
-					for (auto object : resort) {
-						this->insert(object);
+					// The objects stay within this partition, so only the totals of its descendants change:
+					for (auto & object : resort) {
+						Partition * cur = find(object);
+
+						StorageT::insert(cur->_objects, object);
+
+						for (; cur != this; cur = cur->_parent)
+							cur->_total += 1;
 					}
 				}
 
-				// Join this partition with its parent.
+				// Move the objects of all descendants into this partition, and free its children, e.g. once most of its objects have been erased.
 				void coalesce () {
-					//_parent->_children[_location] = NULL;
-					//delete this;
+					if (_children == nullptr) return;
+
+					for (unsigned i = 0; i < TraitsT::Q; i += 1) {
+						Partition & child = _children[i];
+
+						child.coalesce();
+
+						for (auto & object : child._objects)
+							StorageT::append(_objects, object);
+
+						// Release the memory, rather than keeping it in the free partition:
+						ObjectSetT().swap(child._objects);
+					}
+
+					_tree->release_children(_children);
+					_children = nullptr;
 				}
 
 				// Insert an object in this partition or a child.
@@ -221,7 +369,8 @@ namespace Euclid {
 				{
 					Partition * cur = find(object);
 
-					cur->objects().insert(object);
+					if (StorageT::insert(cur->_objects, object))
+						cur->add_to_total(1);
 
 					return cur;
 				}
@@ -231,7 +380,8 @@ namespace Euclid {
 				{
 					Partition * cur = find(object);
 
-					cur->objects().erase(object);
+					if (StorageT::erase(cur->_objects, object))
+						cur->add_to_total(-1);
 
 					return cur;
 				}
@@ -241,31 +391,59 @@ namespace Euclid {
 					SpaceT b = TraitsT::calculate_bounding_box(object);
 					Partition *cur = this;
 
-					unsigned i = 0;
-					while (i < TraitsT::Q) {
-						Partition *c = cur->child(i);
-
-						if (c && c->bounding_box().contains_box(b)) {
-							// Descend into the current partition
-							cur = c;
-							i = 0;
-						} else {
-							// Try the next partition
-							i += 1;
+					if constexpr (TraitsT::LOOSENESS > 1) {
+						return find_loose(b);
+					}
+
+					CellT first, last;
+					if (!_tree->cells_for_box(b, first, last) || !contains_cells(first, last)) return cur;
+
+					// The object is in the child at the next level if the first and last cells it covers are both in the child, i.e. they have the same leading bits:
+					while (cur->_children) {
+						unsigned shift = MAXIMUM_LEVEL - (cur->_level + 1), index = 0;
+
+						for (dimension i = 0; i < TraitsT::D; i += 1) {
+							if ((first[i] >> shift) != (last[i] >> shift))
+								return cur;
+
+							index |= ((first[i] >> shift) & 1) << i;
 						}
+
+						cur = cur->_children + index;
+					}
+
+					return cur;
+				}
+
+				// Find the partition for an object in a loose tree, which is the partition containing its center at the level given by its size, or the deepest partition above that level.
+				Partition * find_loose (const SpaceT & b) {
+					Partition *cur = this;
+
+					CellT cell, last;
+					if (!_tree->cells_for_box(SpaceT(b.center(), b.center()), cell, last) || !contains_cells(cell, cell)) return cur;
+
+					unsigned level = _tree->level_for_size(b.size());
+
+					while (cur->_children && cur->_level < level) {
+						unsigned shift = MAXIMUM_LEVEL - (cur->_level + 1), index = 0;
+
+						for (dimension i = 0; i < TraitsT::D; i += 1)
+							index |= ((cell[i] >> shift) & 1) << i;
+
+						cur = cur->_children + index;
 					}
 
 					return cur;
 				}
 
 				// Return the smallest partition for the given point.
-				Partition* partition_for_point (const Vec2 &point) {
+				Partition* partition_for_point (const VecT &point) {
 					if (bounding_box().contains_point(point, true)) {
 						// A child potentially contains the point
 						Partition *t = NULL;
 						for (unsigned i = 0; i < TraitsT::Q; i += 1) {
-							if (child(i)) {
-								t = child(i).partition_for_point(point);
+							if (child(i) && child(i)->bounding_box().contains_point(point, true)) {
+								t = child(i)->partition_for_point(point);
 
 								if (t) return t;
 							}
@@ -282,7 +460,7 @@ namespace Euclid {
 						// A child potentially contains the point
 						Partition *t = NULL;
 						for (unsigned i = 0; i < TraitsT::Q; i += 1) {
-							if (child(i)) {
+							if (child(i) && child(i)->bounding_box().contains_box(rect, true)) {
 								t = child(i)->partition_for_rect(rect);
 
 								if (t) return t;
@@ -293,84 +471,281 @@ namespace Euclid {
 					return this;
 				}
 
-				// Return all objets in the given partition including children.
-				ObjectSetT all_objects () {
-					ObjectSetT objects;
-					Partition * cur = this;
+				// Visit all objects in this partition and its parents, i.e. the objects which might overlap this partition. The callback is given each object, and can return false to stop early, in which case this returns false. Nothing is allocated.
+				template <typename CallbackT>
+				bool visit_all_objects (CallbackT && callback) const {
+					for (const Partition * cur = this; cur != NULL; cur = cur->_parent) {
+						for (auto & object : cur->_objects)
+							if (!accept_query_result(callback, object)) return false;
+					}
 
-					while (cur != NULL) {
-						objects.insert(cur->_objects.begin(), cur->_objects.end());
+					return true;
+				}
 
-						cur = cur->_parent;
+				// Visit the objects which intersect the given rectangle, in this partition and its children. The callback can return false to stop early, in which case this returns false. Nothing is allocated.
+				template <typename CallbackT>
+				bool visit_objects_in_rect (const SpaceT & rect, CallbackT && callback) const {
+					for (auto & object : _objects) {
+						if (TraitsT::calculate_bounding_box(object).intersects_with(rect))
+							if (!accept_query_result(callback, object)) return false;
 					}
 
-					return objects;
-				};
+					if (_children) {
+						for (unsigned i = 0; i < TraitsT::Q; i += 1) {
+							if (_children[i].loose_bounding_box().intersects_with(rect))
+								if (!_children[i].visit_objects_in_rect(rect, callback)) return false;
+						}
+					}
 
-				// Return the set of objects in a given rectangle.
-				ObjectSetT objects_in_rect (const SpaceT & _rect) {
-					SpaceT rect(_rect);
-					rect.clip_to_box(this->bounding_box());
+					return true;
+				}
 
-					ObjectSetT selection;
+				// Visit the objects whose bounding boxes intersect the given line segment, in this partition and its children. The callback can return false to stop early, in which case this returns false. Nothing is allocated.
+				template <typename CallbackT>
+				bool visit_objects_along_line (const LineSegment<TraitsT::D> & line, CallbackT && callback) const {
+					RealT t1, t2;
 
-					for(auto object : _objects) {
-						SpaceT b = TraitsT::calculate_bounding_box(object);
+					for (auto & object : _objects) {
+						if (line.intersects_with(TraitsT::calculate_bounding_box(object), t1, t2))
+							if (!accept_query_result(callback, object)) return false;
+					}
 
-						if (b.intersects_with(rect)) {
-							selection.insert(object);
+					if (_children) {
+						for (unsigned i = 0; i < TraitsT::Q; i += 1) {
+							if (line.intersects_with(_children[i].loose_bounding_box(), t1, t2))
+								if (!_children[i].visit_objects_along_line(line, callback)) return false;
 						}
 					}
 
-					for (unsigned i = 0; i < TraitsT::Q; i += 1) {
-						if (child(i) == NULL) continue;
+					return true;
+				}
 
-						if (child(i)->bounding_box().intersects_with(rect)) {
-							ObjectSetT child_selection = child(i)->objects_in_rect(rect);
+				// Copy all objects in this partition and its parents to the output iterator.
+				template <typename OutputIteratorT>
+				OutputIteratorT all_objects (OutputIteratorT output) const {
+					visit_all_objects([&](const ObjectT & object) {*output++ = object;});
 
-							selection.insert(child_selection.begin(), child_selection.end());
-						}
-					}
+					return output;
+				}
 
-					return selection;
+				// Copy the objects in the given rectangle to the output iterator.
+				template <typename OutputIteratorT>
+				OutputIteratorT objects_in_rect (const SpaceT & rect, OutputIteratorT output) const {
+					visit_objects_in_rect(rect, [&](const ObjectT & object) {*output++ = object;});
+
+					return output;
+				}
+
+				// Copy the objects along the given line segment to the output iterator.
+				template <typename OutputIteratorT>
+				OutputIteratorT objects_along_line (const LineSegment<TraitsT::D> & line, OutputIteratorT output) const {
+					visit_objects_along_line(line, [&](const ObjectT & object) {*output++ = object;});
+
+					return output;
 				}
 
-				// This function probably needs to be fixed
-				ObjectSetT objects_along_line (const LineSegment<TraitsT::D> &l) {
+				// Return all objets in the given partition including children.
+				ObjectSetT all_objects () const {
+					ObjectSetT objects;
+
+					visit_all_objects([&](const ObjectT & object) {StorageT::append(objects, object);});
+
+					return objects;
+				};
+
+				// Return the set of objects in a given rectangle.
+				ObjectSetT objects_in_rect (const SpaceT & rect) const {
 					ObjectSetT selection;
 
-					for (unsigned i = 0; i < TraitsT::Q; i += 1) {
-						if (child(i) == NULL) continue;
+					visit_objects_in_rect(rect, [&](const ObjectT & object) {StorageT::append(selection, object);});
 
-						if (child(i)->bounding_box().intersects_with(l, true)) {
-							// Add all current-level objects
-							selection.insert(child(i)->objects().begin(), child(i)->objects().end());
+					return selection;
+				}
 
-							// Add any more children objects
-							ObjectSetT objs = child(i)->objects_along_line(l);
-							selection.insert(objs.begin(), objs.end());
-						}
-					}
+				// Return the set of objects whose bounding boxes intersect the given line segment.
+				ObjectSetT objects_along_line (const LineSegment<TraitsT::D> & line) const {
+					ObjectSetT selection;
+
+					visit_objects_along_line(line, [&](const ObjectT & object) {StorageT::append(selection, object);});
 
 					return selection;
 				}
 			};
 
 		protected:
-			SpaceT _bounds;
+			// The children of one partition, which are allocated and freed together.
+			struct Children {
+				Partition partitions[TraitsT::Q];
+			};
+
+			VecT _origin, _size;
 			bool _expanding;
 			Partition _top;
 
-			void expand (const unsigned & dir) {
-				if (dir && LEFT) {
-					if (dir && TOP) {
-					} else {
+			// The storage for all partitions apart from the top. A deque never moves its elements, so the partitions stay where they are as the tree grows, and they are allocated in large blocks rather than one at a time.
+			std::deque<Children> _children;
+
+			// Children which have been coalesced, and can be reused.
+			std::vector<Partition *> _free_children;
+
+			// The range of cells at MAXIMUM_LEVEL covered by a box, or false if the box isn't inside the tree. A box which ends exactly on the edge of a cell doesn't cover the next one, so that the edges of a partition are included in it, as with AlignedBox::contains_box.
+			bool cells_for_box (const SpaceT & box, CellT & first, CellT & last) const {
+				const double CELLS = double(std::uint64_t(1) << MAXIMUM_LEVEL);
+
+				for (dimension i = 0; i < TraitsT::D; i += 1) {
+					double scale = CELLS / _size[i];
+					double lower = std::floor((box.min()[i] - _origin[i]) * scale), upper = std::ceil((box.max()[i] - _origin[i]) * scale) - 1;
+
+					if (!(lower >= 0 && upper < CELLS)) return false;
+
+					first[i] = std::uint32_t(lower);
+					last[i] = std::uint32_t(std::max(lower, upper));
+				}
+
+				return true;
+			}
+
+			// The deepest level at which an object of the given size fits in the loose bounds of the partition containing its center. Partitions at level L are 2^-L the size of the tree, and their bounds allow objects up to LOOSENESS - 1 times that size.
+			unsigned level_for_size (const VecT & size) const {
+				RealT extent = 0;
+
+				for (dimension i = 0; i < TraitsT::D; i += 1)
+					extent = std::max(extent, size[i] / _size[i]);
+
+				unsigned level = 0;
+				RealT limit = TraitsT::LOOSENESS - 1;
+
+				while (level < MAXIMUM_LEVEL && extent <= limit / 2) {
+					limit /= 2;
+					level += 1;
+				}
+
+				return level;
+			}
+
+			Partition * allocate_children (Partition * parent) {
+				Partition * children;
+
+				if (_free_children.empty()) {
+					_children.emplace_back();
+					children = _children.back().partitions;
+				} else {
+					children = _free_children.back();
+					_free_children.pop_back();
+				}
+
+				for (unsigned i = 0; i < TraitsT::Q; i += 1) {
+					CellT cell = parent->_cell * 2;
+
+					for (dimension j = 0; j < TraitsT::D; j += 1)
+						cell[j] += (i >> j) & 1;
+
+					children[i].attach(this, parent, cell, parent->_level + 1);
+				}
+
+				return children;
+			}
+
+			void release_children (Partition * children) {
+				_free_children.push_back(children);
+			}
+
+			// Move every partition down one level, in the given location of the new top partition.
+			static void move_down (Partition & partition, unsigned location) {
+				for (dimension i = 0; i < TraitsT::D; i += 1)
+					partition._cell[i] += ((location >> i) & 1) << partition._level;
+
+				partition._level += 1;
+
+				if (partition._children) {
+					for (unsigned i = 0; i < TraitsT::Q; i += 1)
+						move_down(partition._children[i], location);
+				}
+			}
+
+			static unsigned deepest_level (const Partition & partition) {
+				unsigned level = partition._level;
+
+				if (partition._children) {
+					for (unsigned i = 0; i < TraitsT::Q; i += 1)
+						level = std::max(level, deepest_level(partition._children[i]));
+				}
+
+				return level;
+			}
+
+			// Double the size of the tree in the given directions, e.g. LEFT | BOTTOM, so that the top partition becomes a child of a new top partition. Along each axis, the tree grows in the negative direction if it is given, and in the positive direction otherwise. Returns false if the tree is already as deep as it can be.
+			bool expand (const unsigned & dir) {
+				if (deepest_level(_top) >= MAXIMUM_LEVEL) return false;
+
+				// The location of the current top partition within the new top partition:
+				unsigned location = 0;
+
+				for (dimension i = 0; i < TraitsT::D; i += 1) {
+					// Direction has a pair of flags for each axis, e.g. LEFT and RIGHT for the x-axis:
+					if (dir & (LEFT << (2 * i))) {
+						location |= 1 << i;
+						_origin[i] -= _size[i];
 					}
 				}
+
+				_size *= 2;
+
+				move_down(_top, location);
+
+				// Move the children of the top partition into its new child:
+				ObjectSetT objects;
+				std::swap(objects, _top._objects);
+				Partition * grandchildren = _top._children;
+				std::size_t total = _top._total;
+
+				_top.attach(this, nullptr, ZERO, 0);
+				_top._children = allocate_children(&_top);
+				_top._total = total;
+
+				Partition & child = _top._children[location];
+				child._children = grandchildren;
+				child._total = total - objects.size();
+
+				if (grandchildren) {
+					for (unsigned i = 0; i < TraitsT::Q; i += 1)
+						grandchildren[i]._parent = &child;
+				}
+
+				// The objects of the top partition are found again, since they might not be inside the new child, e.g. a loose object whose center was outside the tree:
+				for (auto & object : objects) {
+					Partition * cur = _top.find(object);
+
+					StorageT::insert(cur->_objects, object);
+
+					for (; cur != &_top; cur = cur->_parent)
+						cur->_total += 1;
+				}
+
+				return true;
+			}
+
+			// The directions in which to expand the tree so that it grows towards the given box.
+			unsigned direction_towards (const SpaceT & box) const {
+				unsigned dir = 0;
+
+				for (dimension i = 0; i < TraitsT::D; i += 1)
+					dir |= (box.min()[i] < _origin[i] ? LEFT : RIGHT) << (2 * i);
+
+				return dir;
 			}
 
 		public:
-			AlignedTree (const VecT & origin, const VecT & size) : _bounds(origin, origin + size), _expanding(true), _top(this, origin, size) {
+			AlignedTree (const VecT & origin, const VecT & size) : _origin(origin), _size(size), _expanding(true) {
+				_top.attach(this, nullptr, ZERO, 0);
+			}
+
+			AlignedTree (const AlignedTree &) = delete;
+			AlignedTree & operator= (const AlignedTree &) = delete;
+
+			// The number of partitions in the tree, including the top.
+			std::size_t partition_count () const {
+				return 1 + (_children.size() - _free_children.size()) * TraitsT::Q;
 			}
 
 			// The top partition in the tree.
@@ -393,17 +768,19 @@ namespace Euclid {
 				}
 			}
 
-			// Insert an object if it exists, redistribute the tree if appropriate.
+			// Insert an object if it exists, redistribute the tree if appropriate. If the object is outside the tree, the tree is expanded until it contains the object if expanding() is true, otherwise the object isn't inserted and NULL is returned.
 			Partition * insert (ObjectT o, bool redistribute = true) {
 				SpaceT b = TraitsT::calculate_bounding_box(o);
 
-				if (!_top.bounding_box().contains_box(b))
-					return NULL;
+				while (!_top.loose_bounding_box().contains_box(b)) {
+					if (!_expanding || !expand(direction_towards(b)))
+						return NULL;
+				}
 
 				Partition * p = _top.insert(o);
 
-				// TraitsT::R is the threshold at which we redistribute objects:
-				if (redistribute && p->objects().size() > TraitsT::R) {
+				// TraitsT::R is the threshold at which we redistribute objects. If the partition already has children, the objects left in it don't fit in any of them, so redistributing them again would only move them back:
+				if (redistribute && p->objects().size() > TraitsT::R && p->child(0) == nullptr) {
 					p->redistribute();
 				}
 
@@ -414,29 +791,39 @@ namespace Euclid {
 			Partition * find (ObjectT o) {
 				SpaceT b = TraitsT::calculate_bounding_box(o);
 
-				if (!_top.bounding_box().intersects_with(b))
+				if (!_top.loose_bounding_box().intersects_with(b))
 					return NULL;
 
 				return _top.find(o);
 			}
 
-			// Erase an object if it exists.
+			// Erase an object if it exists. If coalesce is true, the largest subtree above the object with at most COALESCE_THRESHOLD objects is coalesced, so that the tree shrinks as objects are erased. Returns the partition which contained the object, or the partition it was coalesced into.
 			Partition * erase (ObjectT o, bool coalesce = true) {
 				Partition * p = find(o);
 
-				if (p) {
-					p->objects().erase(o);
-				}
+				if (p == NULL) return NULL;
+
+				if (StorageT::erase(p->_objects, o))
+					p->add_to_total(-1);
+
+				if (coalesce) {
+					Partition * coalesced = NULL;
 
-				if (p && p->objects().size() == 0) {
-					p->coalesce();
+					for (Partition * cur = p; cur && cur->_total <= COALESCE_THRESHOLD; cur = cur->_parent)
+						if (cur->_children) coalesced = cur;
+
+					if (coalesced) {
+						coalesced->coalesce();
+
+						return coalesced;
+					}
 				}
 
 				return p;
 			}
 
 			// Find the smallest partition which encloses the given point.
-			Partition* partition_for_point (const Vec2 &point) {
+			Partition* partition_for_point (const VecT &point) {
 				return _top.partition_for_point(point);
 			}
 
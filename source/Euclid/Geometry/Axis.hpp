@@ -12,6 +12,8 @@
 #include "Geometry.hpp"
 #include "../Numerics/Matrix.hpp"
 #include "../Numerics/Quaternion.hpp"
+#include "../Numerics/Affine.hpp"
+#include "../Numerics/DualQuaternion.hpp"
 
 namespace Euclid {
 	namespace Geometry {
@@ -22,6 +24,8 @@ namespace Euclid {
 			typedef Vector<3, _NumericT> Vec3T;
 			typedef Matrix<4, 4, _NumericT> MatrixT;
 			typedef Quaternion<_NumericT> QuaternionT;
+			typedef Affine<_NumericT> AffineT;
+			typedef DualQuaternion<_NumericT> DualQuaternionT;
 
 		protected:
 			Vec3T _translation;
@@ -37,6 +41,23 @@ namespace Euclid {
 			Axis(Vec3T translation, QuaternionT rotation) : _translation(translation), _rotation(rotation) {
 			}
 
+			/// Decompose a rigid transform, which must not contain any scale or shear.
+			Axis(const AffineT & transform) : _translation(transform.translation()), _rotation(transform.rotation()) {
+			}
+
+			Axis(const DualQuaternionT & transform) : _translation(transform.translation()), _rotation(transform.rotation()) {
+			}
+
+			/// Equivalent to from_origin(), but without the constant bottom row.
+			operator AffineT() const {
+				return {_translation, _rotation};
+			}
+
+			/// Equivalent to from_origin(), as a dual quaternion which can be blended.
+			operator DualQuaternionT() const {
+				return {_translation, _rotation};
+			}
+
 			const Vec3T translation() { return _translation; }
 			const QuaternionT rotation() { return _rotation; }
 
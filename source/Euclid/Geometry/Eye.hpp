@@ -58,6 +58,16 @@ namespace Euclid
 			};
 		}
 		
+		/// Same as eye_transformation, but the view matrix must be affine, i.e. a combination of rotations, translations and scales, which allows a cheaper inverse.
+		template <typename NumericT>
+		typename Eye<NumericT>::Transformation affine_eye_transformation(const Matrix<4, 4, NumericT> & projection_matrix, const Matrix<4, 4, NumericT> & view_matrix, NumericT near = 0, NumericT far = 1) {
+			return typename Eye<NumericT>::Transformation {
+				inverse(projection_matrix),
+				inverse_affine(view_matrix),
+				near, far
+			};
+		}
+		
 		extern template struct Eye<float>;
 		extern template struct Eye<double>;
 	}
@@ -0,0 +1,63 @@
+//
+//  Euclid/Geometry/LinearTree.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "LinearTree.hpp"
+
+namespace Euclid {
+	namespace Geometry {
+		void sort_morton_entries (std::vector<MortonEntry> & entries, std::size_t threads) {
+			const std::size_t RADIX = 256;
+
+			std::size_t count = entries.size();
+			if (count < 2) return;
+
+			threads = thread_count(count, threads);
+			std::size_t range = (count + threads - 1) / threads;
+
+			// The bits which differ between any of the codes, so that passes over digits which are the same for every code can be skipped:
+			std::uint64_t first = entries[0].code, differences = 0;
+			for (auto & entry : entries)
+				differences |= entry.code ^ first;
+
+			std::vector<MortonEntry> buffer(count);
+			std::vector<std::size_t> histograms(threads * RADIX);
+
+			for (unsigned shift = 0; shift < 64; shift += 8) {
+				if (((differences >> shift) & (RADIX - 1)) == 0) continue;
+
+				// Each thread counts the digits in its range:
+				parallel_for(threads, threads, [&](std::size_t index) {
+					std::size_t * histogram = histograms.data() + index * RADIX;
+					std::fill_n(histogram, RADIX, 0);
+
+					for (std::size_t i = index * range, end = std::min(i + range, count); i < end; i += 1)
+						histogram[(entries[i].code >> shift) & (RADIX - 1)] += 1;
+				});
+
+				// The offset of each digit in each range is after all smaller digits, and the same digit in earlier ranges, which keeps the sort stable:
+				std::size_t offset = 0;
+
+				for (std::size_t digit = 0; digit < RADIX; digit += 1) {
+					for (std::size_t index = 0; index < threads; index += 1) {
+						std::size_t & bucket = histograms[index * RADIX + digit];
+						std::size_t size = bucket;
+
+						bucket = offset;
+						offset += size;
+					}
+				}
+
+				parallel_for(threads, threads, [&](std::size_t index) {
+					std::size_t * offsets = histograms.data() + index * RADIX;
+
+					for (std::size_t i = index * range, end = std::min(i + range, count); i < end; i += 1)
+						buffer[offsets[(entries[i].code >> shift) & (RADIX - 1)]++] = entries[i];
+				});
+
+				entries.swap(buffer);
+			}
+		}
+	}
+}
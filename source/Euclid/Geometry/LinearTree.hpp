@@ -0,0 +1,324 @@
+//
+//  Euclid/Geometry/LinearTree.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_GEOMETRY_LINEAR_TREE_H
+#define _EUCLID_GEOMETRY_LINEAR_TREE_H
+
+#include "AlignedTree.hpp"
+#include "../Numerics/ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace Euclid {
+	namespace Geometry {
+		// The Morton code of an object, which interleaves the bits of the coordinates of the cell containing its center, and the index of the object.
+		struct MortonEntry {
+			std::uint64_t code;
+			std::uint32_t index;
+		};
+
+		// Sort the entries by their Morton codes using a stable radix sort, which is done concurrently on up to the given number of threads, or one per hardware thread if zero.
+		void sort_morton_entries (std::vector<MortonEntry> & entries, std::size_t threads = 0);
+
+		// Interleave the bits of the coordinates, so that bit i of coordinate j is bit i * D + j of the code. This is the same order as the partition indices of Quadrants and Octants.
+		template <dimension D>
+		std::uint64_t morton_code (const Vector<D, std::uint32_t> & cell);
+
+		template <>
+		inline std::uint64_t morton_code<2> (const Vector<2, std::uint32_t> & cell) {
+			auto spread = [](std::uint64_t x) {
+				x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+				x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+				x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+				x = (x | (x << 2)) & 0x3333333333333333ull;
+				x = (x | (x << 1)) & 0x5555555555555555ull;
+
+				return x;
+			};
+
+			return spread(cell[X]) | (spread(cell[Y]) << 1);
+		}
+
+		template <>
+		inline std::uint64_t morton_code<3> (const Vector<3, std::uint32_t> & cell) {
+			auto spread = [](std::uint64_t x) {
+				x &= 0x1FFFFF;
+				x = (x | (x << 32)) & 0x001F00000000FFFFull;
+				x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+				x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+				x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+				x = (x | (x << 2)) & 0x1249249249249249ull;
+
+				return x;
+			};
+
+			return spread(cell[X]) | (spread(cell[Y]) << 1) | (spread(cell[Z]) << 2);
+		}
+
+		// A linear quad-tree or oct-tree, which is built from all of its objects at once rather than by inserting them one at a time. The objects are sorted by the Morton codes of their centers, so each node of the tree is a contiguous range of objects, and the nodes are stored in depth first order in a single array, where each node knows the index of the node after its descendants, so there are no pointers to follow. Each node stores the bounds of its objects, so objects which straddle the edges of the cells are still found by queries.
+		template <typename _TraitsT, typename ObjectT>
+		class LinearTree {
+		public:
+			typedef _TraitsT TraitsT;
+			typedef typename TraitsT::VecT VecT;
+			typedef typename TraitsT::SpaceT SpaceT;
+			typedef std::vector<ObjectT> ObjectSetT;
+
+			// The number of levels below the top, so that the Morton codes fit in 64 bits.
+			static constexpr unsigned LEVELS = TraitsT::D == 2 ? 31 : 21;
+
+			struct Node {
+				// The bounds of all objects in this node.
+				SpaceT bounds;
+
+				// The Morton code of the cell which contains the centers of all objects in this node, at the given level.
+				std::uint64_t code;
+				std::uint32_t level;
+
+				// The objects in this node are [begin, end), and the next node which isn't a descendant of this node is skip.
+				std::uint32_t begin, end, skip;
+			};
+
+		protected:
+			std::vector<Node> _nodes;
+
+			// The objects and their bounding boxes, in Morton order.
+			std::vector<ObjectT> _objects;
+			std::vector<SpaceT> _boxes;
+
+			// Add the node for the given range of sorted entries, whose objects are all in the cell with the common prefix of their codes. Nodes with more than TraitsT::R objects are split into children, skipping the levels where all objects are in the same child.
+			std::size_t build_node (const std::vector<MortonEntry> & entries, std::size_t begin, std::size_t end) {
+				const std::uint64_t first = entries[begin].code, difference = first ^ entries[end - 1].code;
+
+				// The deepest level at which all the codes are in the same cell:
+				unsigned level = LEVELS;
+				if (difference) {
+					unsigned highest_bit = 63;
+					while (!(difference >> highest_bit)) highest_bit -= 1;
+
+					level = LEVELS - 1 - highest_bit / TraitsT::D;
+				}
+
+				std::size_t index = _nodes.size();
+				_nodes.emplace_back();
+
+				SpaceT bounds = _boxes[begin];
+
+				if (end - begin > TraitsT::R && difference) {
+					// The children are the ranges of codes with the same digit at the next level:
+					unsigned shift = TraitsT::D * (LEVELS - 1 - level);
+
+					for (std::size_t child_begin = begin; child_begin < end;) {
+						std::uint64_t digit = entries[child_begin].code >> shift;
+
+						std::size_t child_end = std::upper_bound(entries.begin() + child_begin, entries.begin() + end, digit, [&](std::uint64_t digit, const MortonEntry & entry) {
+							return digit < (entry.code >> shift);
+						}) - entries.begin();
+
+						std::size_t child = build_node(entries, child_begin, child_end);
+						bounds.union_with_box(_nodes[child].bounds);
+
+						child_begin = child_end;
+					}
+				} else {
+					for (std::size_t i = begin + 1; i < end; i += 1)
+						bounds.union_with_box(_boxes[i]);
+				}
+
+				Node & node = _nodes[index];
+				node.bounds = bounds;
+				node.code = level == LEVELS ? first : first >> (TraitsT::D * (LEVELS - level));
+				node.level = level;
+				node.begin = std::uint32_t(begin);
+				node.end = std::uint32_t(end);
+				node.skip = std::uint32_t(_nodes.size());
+
+				return index;
+			}
+
+		public:
+			LinearTree () {}
+
+			template <typename IteratorT>
+			LinearTree (IteratorT begin, IteratorT end, std::size_t threads = 0) {
+				build(begin, end, threads);
+			}
+
+			// Replace the objects in the tree. The bounding boxes and Morton codes of the objects are computed and sorted concurrently on up to the given number of threads, or one per hardware thread if zero, and the tree is the same for any number of threads.
+			template <typename IteratorT>
+			void build (IteratorT begin, IteratorT end, std::size_t threads = 0) {
+				std::vector<ObjectT> objects(begin, end);
+				std::size_t count = objects.size();
+
+				_nodes.clear();
+				_objects.clear();
+				_boxes.clear();
+
+				if (count == 0) return;
+
+				std::vector<SpaceT> boxes(count);
+
+				// The bounds of the centers of the objects, which are divided into the cells at the deepest level:
+				std::mutex mutex;
+				VecT minimum = TraitsT::calculate_bounding_box(objects[0]).center(), maximum = minimum;
+
+				parallel_ranges(count, threads, [&](std::size_t begin, std::size_t end) {
+					VecT range_minimum = TraitsT::calculate_bounding_box(objects[begin]).center(), range_maximum = range_minimum;
+
+					for (std::size_t i = begin; i < end; i += 1) {
+						boxes[i] = TraitsT::calculate_bounding_box(objects[i]);
+
+						VecT center = boxes[i].center();
+
+						for (dimension j = 0; j < TraitsT::D; j += 1) {
+							range_minimum[j] = std::min(range_minimum[j], center[j]);
+							range_maximum[j] = std::max(range_maximum[j], center[j]);
+						}
+					}
+
+					std::lock_guard<std::mutex> lock(mutex);
+
+					for (dimension j = 0; j < TraitsT::D; j += 1) {
+						minimum[j] = std::min(minimum[j], range_minimum[j]);
+						maximum[j] = std::max(maximum[j], range_maximum[j]);
+					}
+				});
+
+				std::vector<MortonEntry> entries(count);
+
+				parallel_ranges(count, threads, [&](std::size_t begin, std::size_t end) {
+					const double CELLS = double(std::uint32_t(1) << LEVELS);
+					VecT scale;
+
+					for (dimension j = 0; j < TraitsT::D; j += 1)
+						scale[j] = maximum[j] > minimum[j] ? RealT(CELLS / (double(maximum[j]) - minimum[j])) : 0;
+
+					for (std::size_t i = begin; i < end; i += 1) {
+						VecT center = boxes[i].center();
+						Vector<TraitsT::D, std::uint32_t> cell;
+
+						for (dimension j = 0; j < TraitsT::D; j += 1)
+							cell[j] = std::uint32_t(std::min(double((center[j] - minimum[j]) * scale[j]), CELLS - 1));
+
+						entries[i] = {morton_code<TraitsT::D>(cell), std::uint32_t(i)};
+					}
+				});
+
+				sort_morton_entries(entries, threads);
+
+				_objects.resize(count);
+				_boxes.resize(count);
+
+				parallel_ranges(count, threads, [&](std::size_t begin, std::size_t end) {
+					for (std::size_t i = begin; i < end; i += 1) {
+						_objects[i] = std::move(objects[entries[i].index]);
+						_boxes[i] = boxes[entries[i].index];
+					}
+				});
+
+				build_node(entries, 0, count);
+			}
+
+			// The nodes in depth first order, where the first node contains all objects.
+			const std::vector<Node> & nodes () const { return _nodes; }
+
+			// All objects, in Morton order.
+			const ObjectSetT & objects () const { return _objects; }
+
+			// Whether the node has no children, in which case it is the only node containing its objects.
+			bool is_leaf (const Node & node) const {
+				return node.skip == (&node - _nodes.data()) + 1;
+			}
+
+			// Visit the objects which intersect the given rectangle. The callback can return false to stop early, in which case this returns false. Nothing is allocated.
+			template <typename CallbackT>
+			bool visit_objects_in_rect (const SpaceT & rect, CallbackT && callback) const {
+				for (std::size_t i = 0; i < _nodes.size();) {
+					const Node & node = _nodes[i];
+
+					if (!node.bounds.intersects_with(rect)) {
+						i = node.skip;
+						continue;
+					}
+
+					if (node.skip == i + 1) {
+						for (std::size_t j = node.begin; j < node.end; j += 1)
+							if (_boxes[j].intersects_with(rect))
+								if (!accept_query_result(callback, _objects[j])) return false;
+					}
+
+					i += 1;
+				}
+
+				return true;
+			}
+
+			// Visit the objects whose bounding boxes intersect the given line segment. The callback can return false to stop early, in which case this returns false. Nothing is allocated.
+			template <typename CallbackT>
+			bool visit_objects_along_line (const LineSegment<TraitsT::D> & line, CallbackT && callback) const {
+				RealT t1, t2;
+
+				for (std::size_t i = 0; i < _nodes.size();) {
+					const Node & node = _nodes[i];
+
+					if (!line.intersects_with(node.bounds, t1, t2)) {
+						i = node.skip;
+						continue;
+					}
+
+					if (node.skip == i + 1) {
+						for (std::size_t j = node.begin; j < node.end; j += 1)
+							if (line.intersects_with(_boxes[j], t1, t2))
+								if (!accept_query_result(callback, _objects[j])) return false;
+					}
+
+					i += 1;
+				}
+
+				return true;
+			}
+
+			// Copy the objects in the given rectangle to the output iterator.
+			template <typename OutputIteratorT>
+			OutputIteratorT objects_in_rect (const SpaceT & rect, OutputIteratorT output) const {
+				visit_objects_in_rect(rect, [&](const ObjectT & object) {*output++ = object;});
+
+				return output;
+			}
+
+			// Copy the objects along the given line segment to the output iterator.
+			template <typename OutputIteratorT>
+			OutputIteratorT objects_along_line (const LineSegment<TraitsT::D> & line, OutputIteratorT output) const {
+				visit_objects_along_line(line, [&](const ObjectT & object) {*output++ = object;});
+
+				return output;
+			}
+
+			// Return the objects in a given rectangle.
+			ObjectSetT objects_in_rect (const SpaceT & rect) const {
+				ObjectSetT selection;
+
+				objects_in_rect(rect, std::back_inserter(selection));
+
+				return selection;
+			}
+
+			// Return the objects whose bounding boxes intersect the given line segment.
+			ObjectSetT objects_along_line (const LineSegment<TraitsT::D> & line) const {
+				ObjectSetT selection;
+
+				objects_along_line(line, std::back_inserter(selection));
+
+				return selection;
+			}
+		};
+	}
+}
+
+#endif
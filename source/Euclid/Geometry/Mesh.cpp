@@ -10,9 +10,12 @@
 #include "Mesh.hpp"
 
 #include "../Numerics/Matrix.Multiply.hpp"
+#include "../Numerics/ThreadPool.hpp"
 #include "Triangle.hpp"
 #include "Line.hpp"
 
+#include <algorithm>
+
 namespace Euclid {
 	namespace Geometry {
 		void VertexP3N3M2::apply(const Mat44 & transform) {
@@ -20,5 +23,14 @@ namespace Euclid {
 			normal = ((transform * (position + normal)) - new_position).normalize();
 			position = new_position;
 		}
+
+		void skin(const VertexP3N3M2 * vertices, std::size_t count, const DualQuat * palette, const BoneInfluences * influences, Vec3 * positions, Vec3 * normals, std::size_t threads) {
+			auto skin_range = [&](std::size_t begin, std::size_t end) {
+				skin_vertices(palette, influences + begin, &vertices[begin].position, &vertices[begin].normal, sizeof(VertexP3N3M2), positions + begin, normals + begin, end - begin);
+			};
+
+			// Every range except the last is a multiple of 8 vertices, so that only the last one has a remainder which isn't a full SIMD packet:
+			parallel_ranges(count, threads, skin_range, 8);
+		}
 	}
 }
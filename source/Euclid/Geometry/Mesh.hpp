@@ -12,6 +12,7 @@
 
 #include "Geometry.hpp"
 #include "AlignedBox.hpp"
+#include "../Numerics/DualQuaternion.hpp"
 
 #include <set>
 #include <vector>
@@ -72,6 +73,15 @@ namespace Euclid {
 				return *this;
 			}
 		};
+
+		/// Skin an array of vertices using dual quaternion linear blending, writing count skinned positions and normals. The vertices are split into ranges which are skinned concurrently on up to the given number of threads, or one per hardware thread if zero.
+		void skin(const VertexP3N3M2 * vertices, std::size_t count, const DualQuat * palette, const BoneInfluences * influences, Vec3 * positions, Vec3 * normals, std::size_t threads = 0);
+
+		/// Skin the vertices of a mesh, where influences, positions and normals have one entry per vertex.
+		template <typename IndexType>
+		void skin(const Mesh<VertexP3N3M2, IndexType> & mesh, const DualQuat * palette, const BoneInfluences * influences, Vec3 * positions, Vec3 * normals, std::size_t threads = 0) {
+			skin(mesh.vertices.data(), mesh.vertices.size(), palette, influences, positions, normals, threads);
+		}
 	}
 }
 
@@ -0,0 +1,23 @@
+//
+//  Numerics/Affine.Dispatch.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Affine.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		void multiply(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & left, const Matrix<3, 4, float> & right) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right))
+		}
+
+		void inverse(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & source) {
+			EUCLID_NUMERICS_KERNELS_CALL(inverse(result, source))
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,24 @@
+//
+//  Numerics/Affine.Dispatch.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_AFFINE_DISPATCH_H
+#define _EUCLID_NUMERICS_AFFINE_DISPATCH_H
+
+#include "Matrix.hpp"
+#include "Instructions.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		void multiply(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & left, const Matrix<3, 4, float> & right);
+		void inverse(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & source);
+	}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,74 @@
+//
+//  Numerics/Affine.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The affine composition and inverse kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set.
+
+namespace {
+	typedef Packet<float, 4> AffinePacketT;
+
+	/// A packet with (0, 0, 0, 1), which selects the translation column when the rows of a 3x4 matrix are held in packets.
+	inline AffinePacketT translation_lane ()
+	{
+		static const float lanes[4] = {0, 0, 0, 1};
+
+		return AffinePacketT::load(lanes);
+	}
+
+	/// The cross products of the first three lanes of a and b.
+	inline AffinePacketT cross_lanes (const AffinePacketT & a, const AffinePacketT & b)
+	{
+		return a.swizzle<1, 2, 0, 3>() * b.swizzle<2, 0, 1, 3>() - a.swizzle<2, 0, 1, 3>() * b.swizzle<1, 2, 0, 3>();
+	}
+
+	/// The sum of the first three lanes of a, in every lane.
+	inline AffinePacketT sum_lanes (const AffinePacketT & a)
+	{
+		return a.swizzle<0, 0, 0, 0>() + a.swizzle<1, 1, 1, 1>() + a.swizzle<2, 2, 2, 2>();
+	}
+
+	/// One row of left * right, given the row of the left matrix and the rows of the right matrix. The translation of the left matrix is added in the last lane.
+	inline AffinePacketT multiply_row (const AffinePacketT & left, const AffinePacketT & x, const AffinePacketT & y, const AffinePacketT & z, const AffinePacketT & translation)
+	{
+		AffinePacketT r = left * translation;
+		r = multiply_add(left.swizzle<0, 0, 0, 0>(), x, r);
+		r = multiply_add(left.swizzle<1, 1, 1, 1>(), y, r);
+		return multiply_add(left.swizzle<2, 2, 2, 2>(), z, r);
+	}
+}
+
+void multiply(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & left, const Matrix<3, 4, float> & right) {
+	// The four columns of a 3x4 matrix are packed like four vectors, so they are loaded as rows, with one column in each lane:
+	AffinePacketT lx, ly, lz, rx, ry, rz;
+	load_vectors(left.data(), lx, ly, lz);
+	load_vectors(right.data(), rx, ry, rz);
+
+	AffinePacketT translation = translation_lane();
+
+	store_vectors(result.data(), multiply_row(lx, rx, ry, rz, translation), multiply_row(ly, rx, ry, rz, translation), multiply_row(lz, rx, ry, rz, translation));
+}
+
+void inverse(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & source) {
+	const float * m = source.data();
+
+	// The columns are three floats apart, so the last lane of each holds the next column. The translation is loaded from the end of the matrix so that it isn't read past:
+	AffinePacketT c0 = AffinePacketT::load(m), c1 = AffinePacketT::load(m + 3), c2 = AffinePacketT::load(m + 6);
+	AffinePacketT c3 = AffinePacketT::load(m + 8).swizzle<1, 2, 3, 3>();
+
+	// The rows of the inverse of the upper 3x3 are the cross products of its columns, divided by the determinant:
+	AffinePacketT r0 = cross_lanes(c1, c2), r1 = cross_lanes(c2, c0), r2 = cross_lanes(c0, c1);
+	AffinePacketT factor = AffinePacketT::broadcast(1) / sum_lanes(c0 * r0);
+
+	r0 = r0 * factor;
+	r1 = r1 * factor;
+	r2 = r2 * factor;
+
+	// The translation of the inverse is -(rows . translation), which replaces the last lane of each row:
+	AffinePacketT zero = AffinePacketT::broadcast(0), lane = translation_lane();
+	r0 = lane.select_greater(zero, zero - sum_lanes(r0 * c3), r0);
+	r1 = lane.select_greater(zero, zero - sum_lanes(r1 * c3), r1);
+	r2 = lane.select_greater(zero, zero - sum_lanes(r2 * c3), r2);
+
+	store_vectors(result.data(), r0, r1, r2);
+}
@@ -0,0 +1,268 @@
+//
+//  Numerics/Affine.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_AFFINE_H
+#define _EUCLID_NUMERICS_AFFINE_H
+
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Vector.Geometry.hpp"
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+// MARK: -
+// MARK: Affine Multiplication
+
+		/// Compose two affine transforms stored as the upper 3x4 of a 4x4 matrix, i.e. result = left * right, where the bottom row of both is implicitly (0, 0, 0, 1). The result may be the same matrix as either argument.
+		template <typename NumericT>
+		void multiply (Matrix<3, 4, NumericT> & result, const Matrix<3, 4, NumericT> & left, const Matrix<3, 4, NumericT> & right)
+		{
+			Matrix<3, 4, NumericT> product;
+
+			for (dimension c = 0; c < 4; c += 1) {
+				for (dimension r = 0; r < 3; r += 1) {
+					product.at(r, c) = left.at(r, 0) * right.at(0, c) + left.at(r, 1) * right.at(1, c) + left.at(r, 2) * right.at(2, c);
+
+					if (c == 3)
+						product.at(r, c) += left.at(r, 3);
+				}
+			}
+
+			result = product;
+		}
+
+		/// Invert an affine transform stored as the upper 3x4 of a 4x4 matrix. The result may be the same matrix as the source.
+		template <typename NumericT>
+		void inverse (Matrix<3, 4, NumericT> & result, const Matrix<3, 4, NumericT> & source)
+		{
+			// The rows of the inverse of the upper 3x3 are the cross products of its columns, divided by the determinant:
+			Vector<3, NumericT> columns[3] = {&source.at(0, 0), &source.at(0, 1), &source.at(0, 2)};
+			Vector<3, NumericT> rows[3];
+
+			for (dimension i = 0; i < 3; i += 1)
+				rows[i] = cross_product(columns[(i + 1) % 3], columns[(i + 2) % 3]);
+
+			NumericT factor = NumericT(1) / columns[0].dot(rows[0]);
+			Vector<3, NumericT> translation = &source.at(0, 3);
+
+			for (dimension i = 0; i < 3; i += 1) {
+				rows[i] *= factor;
+
+				for (dimension c = 0; c < 3; c += 1)
+					result.at(i, c) = rows[i][c];
+
+				result.at(i, 3) = -rows[i].dot(translation);
+			}
+		}
+	}
+}
+
+#include "Affine.Dispatch.hpp"
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+// MARK: -
+// MARK: Affine Class
+
+		/** An affine transform, i.e. any combination of rotations, translations and scales.
+
+		The transform is stored as the upper 3x4 of a column-major 4x4 matrix, and the bottom row is implicitly (0, 0, 0, 1). It therefore uses 25% less storage than Mat44, and composing two transforms takes 36 rather than 64 multiplications. It converts implicitly to and from Mat44, so it can be used wherever a full matrix is required.
+		*/
+		template <typename NumericT = RealT>
+		class Affine : public Matrix<3, 4, NumericT> {
+		public:
+			typedef Matrix<3, 4, NumericT> MatrixT;
+
+			/// Undefined constructor.
+			Affine () = default;
+
+			/// Identity constructor.
+			Affine (const Identity &) : MatrixT(IDENTITY) {}
+
+			Affine (const MatrixT & matrix) : MatrixT(matrix) {}
+
+			/// Convert from a 4x4 matrix, whose bottom row is assumed to be (0, 0, 0, 1).
+			Affine (const Matrix<4, 4, NumericT> & matrix) : MatrixT(matrix) {}
+
+			Affine (const Quaternion<NumericT> & rotation) : MatrixT(rotation) {}
+
+			/// Rotate and then translate, i.e. translate(translation) << rotation.
+			Affine (const Vector<3, NumericT> & translation, const Quaternion<NumericT> & rotation) : MatrixT(rotation)
+			{
+				this->set(0, 3, translation);
+			}
+
+			template <dimension N, typename AxisNumericT>
+			Affine (const Translation<N, AxisNumericT> & translation) : Affine(IDENTITY)
+			{
+				compose(static_cast<MatrixT &>(*this), translation);
+			}
+
+			template <dimension N>
+			Affine (const Scale<N, NumericT> & scale) : Affine(IDENTITY)
+			{
+				compose(static_cast<MatrixT &>(*this), scale);
+			}
+
+			template <typename ScaleFactorT>
+			Affine (const UniformScale<ScaleFactorT> & scale) : Affine(IDENTITY)
+			{
+				compose(static_cast<MatrixT &>(*this), scale);
+			}
+
+			template <dimension AXIS, typename AngleNumericT>
+			Affine (const FixedAxisRotation<AXIS, AngleNumericT> & rotation) : Affine(IDENTITY)
+			{
+				compose(static_cast<MatrixT &>(*this), rotation);
+			}
+
+			template <dimension N, typename AngleNumericT, typename AxisNumericT>
+			Affine (const AngleAxisRotation<N, AngleNumericT, AxisNumericT> & rotation) : Affine(IDENTITY)
+			{
+				compose(static_cast<MatrixT &>(*this), rotation);
+			}
+
+			template <typename A, typename B>
+			Affine (const Transforms<A, B> & transforms) : Affine(IDENTITY)
+			{
+				transforms.apply(static_cast<MatrixT &>(*this));
+			}
+
+			/// The translation component, i.e. where the origin is transformed to.
+			Vector<3, NumericT> translation () const
+			{
+				return &this->at(0, 3);
+			}
+
+			/// The rotation component, assuming the transform has no scale or shear.
+			Quaternion<NumericT> rotation () const
+			{
+				return quaternion(*this);
+			}
+
+			template <typename RightT>
+			Transforms<Affine, RightT> operator<< (const RightT & right) const
+			{
+				return {*this, right};
+			}
+		};
+
+		template <typename NumericT>
+		Affine<NumericT> affine (const Matrix<4, 4, NumericT> & matrix) {
+			return matrix;
+		}
+
+		/// Extract the rotation from an affine transform, assuming it has no scale or shear.
+		template <typename NumericT>
+		Quaternion<NumericT> quaternion (const Matrix<3, 4, NumericT> & m) {
+			NumericT w = number(NumericT(1) + m.at(0, 0) + m.at(1, 1) + m.at(2, 2)).square_root() / 2;
+
+			Vector<4, NumericT> q;
+			q[X] = (m.at(2, 1) - m.at(1, 2)) / (4 * w);
+			q[Y] = (m.at(0, 2) - m.at(2, 0)) / (4 * w);
+			q[Z] = (m.at(1, 0) - m.at(0, 1)) / (4 * w);
+			q[W] = w;
+
+			return q.normalize();
+		}
+
+		template <dimension R, dimension C, typename NumericT> template <typename AffineNumericT>
+		Matrix<R, C, NumericT>::Matrix (const Affine<AffineNumericT> & transform) : std::array<NumericT, R*C>()
+		{
+			for (dimension c = 0; c < std::min<dimension>(C, 4); c += 1)
+				for (dimension r = 0; r < std::min<dimension>(R, 4); r += 1)
+					at(r, c) = r < 3 ? NumericT(transform.at(r, c)) : NumericT(c == 3);
+		}
+
+		template <typename NumericT>
+		Affine<NumericT> operator* (const Affine<NumericT> & left, const Affine<NumericT> & right)
+		{
+			Affine<NumericT> result;
+
+			multiply(result, left, right);
+
+			return result;
+		}
+
+		/// Used by Transforms to compose links which can't be applied in place.
+		template <typename NumericT>
+		Matrix<3, 4, NumericT> & operator*= (Matrix<3, 4, NumericT> & transform, const Matrix<3, 4, NumericT> & step)
+		{
+			multiply(transform, transform, step);
+
+			return transform;
+		}
+
+		template <typename NumericT>
+		Affine<NumericT> inverse (const Affine<NumericT> & source)
+		{
+			Affine<NumericT> result;
+
+			inverse(result, source);
+
+			return result;
+		}
+
+		/// Invert an array of affine transforms, i.e. result[i] = inverse(source[i]). The result may be the same array as the source.
+		template <typename NumericT>
+		void inverse (Affine<NumericT> * result, const Affine<NumericT> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				inverse(result[i], source[i]);
+		}
+
+// MARK: -
+// MARK: Affine Transformation
+
+		template <typename NumericT>
+		Vector<3, NumericT> transform_point (const Matrix<3, 4, NumericT> & transform, const Vector<3, NumericT> & point)
+		{
+			Vector<3, NumericT> result;
+
+			for (dimension r = 0; r < 3; r += 1)
+				result[r] = transform.at(r, 0) * point[0] + transform.at(r, 1) * point[1] + transform.at(r, 2) * point[2] + transform.at(r, 3);
+
+			return result;
+		}
+
+		/// Transform a direction vector, ignoring the translation of the transform.
+		template <typename NumericT>
+		Vector<3, NumericT> transform_vector (const Matrix<3, 4, NumericT> & transform, const Vector<3, NumericT> & vector)
+		{
+			Vector<3, NumericT> result;
+
+			for (dimension r = 0; r < 3; r += 1)
+				result[r] = transform.at(r, 0) * vector[0] + transform.at(r, 1) * vector[1] + transform.at(r, 2) * vector[2];
+
+			return result;
+		}
+
+		template <typename NumericT>
+		Vector<3, NumericT> operator* (const Affine<NumericT> & transform, const Vector<3, NumericT> & point)
+		{
+			return transform_point(transform, point);
+		}
+
+		/// Transform an array of points, i.e. output[i] = transform * input[i]. This uses the optimised 4x4 batch kernels where they are available. The output may be the same array as the input.
+		template <typename NumericT>
+		void transform_points (const Affine<NumericT> & transform, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			transform_points(Matrix<4, 4, NumericT>(transform), input, output, count);
+		}
+
+		/// Transform an array of direction vectors, ignoring the translation of the transform. The output may be the same array as the input.
+		template <typename NumericT>
+		void transform_vectors (const Affine<NumericT> & transform, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			transform_vectors(Matrix<4, 4, NumericT>(transform), input, output, count);
+		}
+	}
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include "Numerics.hpp"
 #include "Number.hpp"
 #include "Float.hpp"
+#include "Trigonometry.hpp"
 
 namespace Euclid
 {
@@ -109,6 +110,24 @@ namespace Euclid
 				return std::tan(value);
 			}
 
+			/// Fast approximations which don't call the standard library, see Trigonometry.hpp for their accuracy.
+			Number<FloatT> fast_sin() const {
+				return Numerics::fast_sin(value);
+			}
+
+			Number<FloatT> fast_cos() const {
+				return Numerics::fast_cos(value);
+			}
+
+			Number<FloatT> fast_tan() const {
+				return Numerics::fast_tan(value);
+			}
+
+			/// Compute both the sine and the cosine, which costs about the same as either.
+			void fast_sin_cos(FloatT & sine, FloatT & cosine) const {
+				Numerics::fast_sin_cos(value, sine, cosine);
+			}
+
 			Radians offset_to (const Radians & other) const {
 				auto x = this->value, y = other.value;
 				return Radians{std::atan2(std::sin(x-y), std::cos(x-y))};
@@ -47,12 +47,19 @@ namespace Euclid
 				_total += value;
 			}
 
-			/// Add samples from another instance of Average.
+			/// Add samples from another instance of Average, e.g. one computed by another thread. The result is the same as if the samples had been added to this instance.
 			void add_samples (const Average<NumericT> & other)
 			{
 				add_samples(other._total, other._samples);
 			}
 
+			/// Remove all the samples.
+			void clear ()
+			{
+				_samples = 0;
+				_total = 0;
+			}
+
 			/// Calculate the average value.
 			/// @returns The average value.
 			NumericT value () const
@@ -64,7 +71,7 @@ namespace Euclid
 
 			/// Check if any samples have been added.
 			/// @returns true if there are samples.
-			bool has_samples ()
+			bool has_samples () const
 			{
 				return _samples != 0;
 			}
@@ -0,0 +1,189 @@
+//
+//  Numerics/Collector.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_COLLECTOR_H
+#define _EUCLID_NUMERICS_COLLECTOR_H
+
+#include "Numerics.hpp"
+
+#include <atomic>
+#include <mutex>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// Collects statistics, e.g. an Average or a StreamingDistribution, from many threads without contention. Each thread adds samples to its own Local statistics, which are published to the collector every INTERVAL samples without taking a lock, and a reader periodically folds the published statistics into a global snapshot. The statistics must be default constructible, and support clear and add_samples with another instance.
+		template <typename StatisticsT>
+		class Collector
+		{
+		protected:
+			/// The statistics published by one thread. The thread and the reader exchange ownership of the published statistics atomically, so neither ever waits for the other.
+			struct Slot
+			{
+				Slot * next = nullptr;
+
+				/// Whether a Local is currently using this slot. Slots are reused by later threads, but never freed until the collector is.
+				std::atomic<bool> owned{true};
+
+				/// The statistics published by the thread since the reader last took them, or null.
+				std::atomic<StatisticsT *> published{nullptr};
+
+				/// Statistics which the reader has emptied, so the thread can publish without allocating.
+				std::atomic<StatisticsT *> recycled{nullptr};
+
+				~Slot ()
+				{
+					delete published.load();
+					delete recycled.load();
+				}
+			};
+
+			std::atomic<Slot *> _slots{nullptr};
+
+			std::mutex _snapshot_mutex;
+			StatisticsT _snapshot;
+
+			Slot * acquire_slot ()
+			{
+				// Reuse the slot of a thread which has finished:
+				for (Slot * slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+					bool owned = false;
+
+					if (slot->owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+						return slot;
+				}
+
+				Slot * slot = new Slot;
+				slot->next = _slots.load(std::memory_order_relaxed);
+
+				while (!_slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed));
+
+				return slot;
+			}
+
+		public:
+			/// The number of samples a Local adds before publishing them. Publishing merges the whole quantile sketch, so it is amortized over many samples.
+			static constexpr std::size_t INTERVAL = 4096;
+
+			/// The statistics of one thread. Adding samples doesn't synchronize with other threads, apart from publishing every INTERVAL samples, which is an atomic exchange. A Local must only be used by one thread at a time, and publishes its remaining samples when it is destroyed.
+			class Local
+			{
+			protected:
+				Slot * _slot;
+				StatisticsT _statistics;
+				std::size_t _pending = 0;
+
+			public:
+				Local (Collector & collector) : _slot(collector.acquire_slot())
+				{
+				}
+
+				Local (const Local &) = delete;
+				Local & operator= (const Local &) = delete;
+
+				~Local ()
+				{
+					publish();
+
+					_slot->owned.store(false, std::memory_order_release);
+				}
+
+				template <typename SampleT>
+				void add_sample (const SampleT & sample)
+				{
+					_statistics.add_sample(sample);
+
+					if (++_pending >= INTERVAL)
+						publish();
+				}
+
+				/// Helper for adding a sample. Same as add_sample.
+				template <typename SampleT>
+				void operator+= (const SampleT & sample)
+				{
+					add_sample(sample);
+				}
+
+				/// Make the samples added so far visible to the next snapshot.
+				void publish ()
+				{
+					if (_pending == 0) return;
+
+					// Take back the statistics which the reader hasn't folded yet, and add to them:
+					StatisticsT * published = _slot->published.exchange(nullptr, std::memory_order_acquire);
+
+					if (published) {
+						published->add_samples(_statistics);
+					} else {
+						published = _slot->recycled.exchange(nullptr, std::memory_order_acquire);
+
+						if (published)
+							*published = _statistics;
+						else
+							published = new StatisticsT(_statistics);
+					}
+
+					_slot->published.store(published, std::memory_order_release);
+
+					_statistics.clear();
+					_pending = 0;
+				}
+			};
+
+			Collector () {}
+
+			Collector (const Collector &) = delete;
+			Collector & operator= (const Collector &) = delete;
+
+			/// All Local statistics must be destroyed before the collector.
+			~Collector ()
+			{
+				Slot * slot = _slots.load();
+
+				while (slot) {
+					Slot * next = slot->next;
+					delete slot;
+					slot = next;
+				}
+			}
+
+			/// The number of slots which have been allocated, which is the largest number of Local statistics which have existed at the same time.
+			std::size_t slot_count () const
+			{
+				std::size_t count = 0;
+
+				for (Slot * slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next)
+					count += 1;
+
+				return count;
+			}
+
+			/// Fold the statistics published since the last snapshot into the snapshot, and return a copy of it. This doesn't block the threads adding samples, and samples which haven't been published yet are included in a later snapshot.
+			StatisticsT snapshot ()
+			{
+				std::lock_guard<std::mutex> lock(_snapshot_mutex);
+
+				for (Slot * slot = _slots.load(std::memory_order_acquire); slot; slot = slot->next) {
+					StatisticsT * published = slot->published.exchange(nullptr, std::memory_order_acquire);
+
+					if (published) {
+						_snapshot.add_samples(*published);
+
+						// Give the statistics back to the thread to reuse, unless it already has some:
+						published->clear();
+						published = slot->recycled.exchange(published, std::memory_order_release);
+
+						delete published;
+					}
+				}
+
+				return _snapshot;
+			}
+		};
+	}
+}
+
+#endif
@@ -11,6 +11,12 @@
 #define _EUCLID_NUMERICS_DISTRIBUTION_H
 
 #include "Average.hpp"
+#include "Number.hpp"
+#include "QuantileSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 namespace Euclid
 {
@@ -46,7 +52,23 @@ namespace Euclid
 				_samples.push_back(sample);
 			}
 
-			bool has_samples ()
+			/// Add the samples from another distribution.
+			void add_samples (const Distribution<NumericT> & other)
+			{
+				if (!other._samples.empty()) {
+					if (!this->has_samples() || other._minimum < _minimum)
+						_minimum = other._minimum;
+
+					if (!this->has_samples() || other._maximum > _maximum)
+						_maximum = other._maximum;
+				}
+
+				Average<NumericT>::add_samples(other);
+
+				_samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+			}
+
+			bool has_samples () const
 			{
 				return Average<NumericT>::has_samples();
 			}
@@ -86,6 +108,167 @@ namespace Euclid
 				return standard_deviation() / number(this->number_of_samples()).square_root();
 			}
 		};
+
+		/// The same statistics as Distribution, computed as the samples are added, without keeping them. The mean and variance are updated using Welford's algorithm in double precision, and the quantiles are estimated by a QuantileSketch, so each update is O(1) and the memory is bounded. This is suitable for continuously measuring e.g. latencies.
+		template <typename NumericT = RealT>
+		class StreamingDistribution
+		{
+		protected:
+			std::size_t _samples = 0;
+			NumericT _minimum = 0, _maximum = 0;
+
+			/// The number of NaN samples, which aren't included in the statistics.
+			std::size_t _ignored = 0;
+
+			/// The running mean, and the sum of the squared differences from it.
+			double _mean = 0, _squared_differences = 0;
+
+			QuantileSketch _quantiles;
+
+		public:
+			/// Add a sample to the statistics. NaN would make every statistic NaN, so it is counted by number_of_ignored_samples instead.
+			void add_sample (const NumericT & sample)
+			{
+				if (std::isnan(double(sample))) {
+					_ignored += 1;
+					return;
+				}
+
+				if (_samples == 0 || sample < _minimum)
+					_minimum = sample;
+
+				if (_samples == 0 || sample > _maximum)
+					_maximum = sample;
+
+				_samples += 1;
+
+				double difference = double(sample) - _mean;
+				_mean += difference / _samples;
+				_squared_differences += difference * (double(sample) - _mean);
+
+				_quantiles.add_sample(double(sample));
+			}
+
+			/// Add the samples from another distribution, e.g. one computed by another thread. The mean and variance are combined using Chan's parallel algorithm, and the quantile sketches are merged exactly, so the result is the same as if every sample had been added to this distribution, up to rounding.
+			void add_samples (const StreamingDistribution<NumericT> & other)
+			{
+				_ignored += other._ignored;
+
+				if (other._samples == 0) return;
+
+				if (_samples == 0) {
+					std::size_t ignored = _ignored;
+
+					*this = other;
+					_ignored = ignored;
+
+					return;
+				}
+
+				if (other._minimum < _minimum)
+					_minimum = other._minimum;
+
+				if (other._maximum > _maximum)
+					_maximum = other._maximum;
+
+				double samples = double(_samples) + double(other._samples);
+				double difference = other._mean - _mean;
+
+				_mean += difference * (other._samples / samples);
+				_squared_differences += other._squared_differences + difference * difference * (_samples * (other._samples / samples));
+
+				_samples += other._samples;
+				_quantiles.add_samples(other._quantiles);
+			}
+
+			/// Helper for adding a sample. Same as add_sample.
+			void operator+= (const NumericT & sample)
+			{
+				add_sample(sample);
+			}
+
+			/// Helper for adding samples. Same as add_samples.
+			void operator+= (const StreamingDistribution<NumericT> & other)
+			{
+				add_samples(other);
+			}
+
+			/// Remove all the samples, keeping the memory used by the quantile sketch.
+			void clear ()
+			{
+				_samples = 0;
+				_minimum = _maximum = 0;
+				_mean = _squared_differences = 0;
+				_ignored = 0;
+
+				_quantiles.clear();
+			}
+
+			bool has_samples () const
+			{
+				return _samples != 0;
+			}
+
+			/// The number of samples taken.
+			std::size_t number_of_samples () const
+			{
+				return _samples;
+			}
+
+			/// The number of NaN samples, which were left out of the statistics.
+			std::size_t number_of_ignored_samples () const
+			{
+				return _ignored;
+			}
+
+			NumericT average () const { return NumericT(_mean); }
+
+			const NumericT & minimum () const { return _minimum; }
+			const NumericT & maximum () const { return _maximum; }
+
+			/// The population variance, i.e. the average squared difference from the mean, which is the same as Distribution::variance().value().
+			NumericT variance () const
+			{
+				if (_samples == 0) return 0;
+
+				return NumericT(_squared_differences / _samples);
+			}
+
+			/// The unbiased estimate of the variance of the population the samples were taken from.
+			NumericT sample_variance () const
+			{
+				if (_samples < 2) return 0;
+
+				return NumericT(_squared_differences / (_samples - 1));
+			}
+
+			Number<NumericT> standard_deviation () const
+			{
+				return number(variance()).square_root();
+			}
+
+			Number<NumericT> standard_error () const
+			{
+				return standard_deviation() / number(this->number_of_samples()).square_root();
+			}
+
+			/// Estimate the value below which the given fraction of the samples lie, see QuantileSketch. The extreme quantiles are the minimum and maximum, which are exact, and the estimate is clamped between them.
+			NumericT quantile (double fraction) const
+			{
+				if (_samples == 0) return 0;
+
+				if (fraction <= 0) return _minimum;
+				if (fraction >= 1) return _maximum;
+
+				double estimate = _quantiles.quantile(fraction);
+
+				return std::min(std::max(NumericT(estimate), _minimum), _maximum);
+			}
+
+			NumericT median () const { return quantile(0.5); }
+
+			const QuantileSketch & quantiles () const { return _quantiles; }
+		};
 	}
 }
 
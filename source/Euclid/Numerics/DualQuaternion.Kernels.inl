@@ -0,0 +1,111 @@
+//
+//  Numerics/DualQuaternion.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The dual quaternion skinning kernel, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set, after Quaternion.Kernels.inl.
+
+namespace {
+	static_assert(sizeof(DualQuaternion<float>) == sizeof(float) * 8, "DualQuaternion<float> must be tightly packed!");
+
+	/// Blend the bones which influence a vertex, and store the real and dual parts of the result.
+	inline void blend_bones (const DualQuaternion<float> * palette, const BoneInfluences & influences, float * real, float * dual)
+	{
+		const Quaternion<float> & pivot = palette[influences.bones[0]].real;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		// The real and dual parts of each bone are blended together:
+		typedef Packet<float, 8> BoneT;
+#else
+		typedef Packet<float, 4> BoneT;
+#endif
+
+		constexpr std::size_t PARTS = 8 / BoneT::WIDTH;
+		BoneT blended[PARTS];
+
+		for (std::size_t j = 0; j < PARTS; j += 1)
+			blended[j] = BoneT::broadcast(0);
+
+		for (std::size_t i = 0; i < BoneInfluences::COUNT; i += 1) {
+			const DualQuaternion<float> & bone = palette[influences.bones[i]];
+
+			// q and -q represent the same rotation, so every bone is blended in the same hemisphere as the first:
+			BoneT weight = BoneT::broadcast(bone.real.dot(pivot) < 0 ? -influences.weights[i] : influences.weights[i]);
+
+			for (std::size_t j = 0; j < PARTS; j += 1)
+				blended[j] = multiply_add(weight, BoneT::load(bone.real.data() + j * BoneT::WIDTH), blended[j]);
+		}
+
+		float result[8];
+
+		for (std::size_t j = 0; j < PARTS; j += 1)
+			blended[j].store(result + j * BoneT::WIDTH);
+
+		for (std::size_t j = 0; j < 4; j += 1) {
+			real[j] = result[j];
+			dual[j] = result[4 + j];
+		}
+	}
+
+	/// Skin WIDTH vertices. The transforms are blended one vertex at a time, and then transposed so that the vertices are transformed together.
+	template <std::size_t WIDTH>
+	inline void skin_packed (const DualQuaternion<float> * palette, const BoneInfluences * influences, const unsigned char * positions, const unsigned char * normals, std::size_t stride, float * skinned_positions, float * skinned_normals)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		float real[WIDTH * 4], dual[WIDTH * 4], position[WIDTH * 3], normal[WIDTH * 3];
+
+		for (std::size_t i = 0; i < WIDTH; i += 1) {
+			blend_bones(palette, influences[i], real + i*4, dual + i*4);
+
+			const float * p = reinterpret_cast<const float *>(positions + i * stride), * n = reinterpret_cast<const float *>(normals + i * stride);
+
+			for (std::size_t j = 0; j < 3; j += 1) {
+				position[i*3 + j] = p[j];
+				normal[i*3 + j] = n[j];
+			}
+		}
+
+		PacketT rx, ry, rz, rw, dx, dy, dz, dw;
+		load_quaternions(real, rx, ry, rz, rw);
+		load_quaternions(dual, dx, dy, dz, dw);
+
+		// Normalize both parts by the length of the real part:
+		PacketT factor = PacketT::broadcast(1) / multiply_add(rw, rw, multiply_add(rz, rz, multiply_add(ry, ry, rx * rx))).square_root();
+
+		rx = rx * factor; ry = ry * factor; rz = rz * factor; rw = rw * factor;
+		dx = dx * factor; dy = dy * factor; dz = dz * factor; dw = dw * factor;
+
+		// The translation is 2 * vector(dual * conjugate(real)), which is unaffected by any component of the dual part which isn't orthogonal to the real part:
+		PacketT two = PacketT::broadcast(2);
+		PacketT tx = (rw * dx - dw * rx + (ry * dz - rz * dy)) * two;
+		PacketT ty = (rw * dy - dw * ry + (rz * dx - rx * dz)) * two;
+		PacketT tz = (rw * dz - dw * rz + (rx * dy - ry * dx)) * two;
+
+		PacketT x, y, z;
+
+		load_vectors(position, x, y, z);
+		rotate_components(rx, ry, rz, rw, x, y, z);
+		store_vectors(skinned_positions, x + tx, y + ty, z + tz);
+
+		load_vectors(normal, x, y, z);
+		rotate_components(rx, ry, rz, rw, x, y, z);
+		store_vectors(skinned_normals, x, y, z);
+	}
+}
+
+void skin_vertices(const DualQuaternion<float> * palette, const BoneInfluences * influences, const Vector<3, float> * positions, const Vector<3, float> * normals, std::size_t stride, Vector<3, float> * skinned_positions, Vector<3, float> * skinned_normals, std::size_t count) {
+	auto position = reinterpret_cast<const unsigned char *>(positions), normal = reinterpret_cast<const unsigned char *>(normals);
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		skin_packed<8>(palette, influences + i, position + i * stride, normal + i * stride, stride, skinned_positions[i].data(), skinned_normals[i].data());
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		skin_packed<4>(palette, influences + i, position + i * stride, normal + i * stride, stride, skinned_positions[i].data(), skinned_normals[i].data());
+
+	for (; i < count; i += 1)
+		skin_packed<1>(palette, influences + i, position + i * stride, normal + i * stride, stride, skinned_positions[i].data(), skinned_normals[i].data());
+}
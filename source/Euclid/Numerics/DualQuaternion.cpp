@@ -0,0 +1,19 @@
+//
+//  Numerics/DualQuaternion.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "DualQuaternion.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		void skin_vertices(const DualQuaternion<float> * palette, const BoneInfluences * influences, const Vector<3, float> * positions, const Vector<3, float> * normals, std::size_t stride, Vector<3, float> * skinned_positions, Vector<3, float> * skinned_normals, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(skin_vertices(palette, influences, positions, normals, stride, skinned_positions, skinned_normals, count))
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,169 @@
+//
+//  Numerics/DualQuaternion.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_DUAL_QUATERNION_H
+#define _EUCLID_NUMERICS_DUAL_QUATERNION_H
+
+#include "Quaternion.hpp"
+#include "Affine.hpp"
+#include "Instructions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/** A dual quaternion represents a rigid transform, i.e. a rotation followed by a translation, as real + dual * e where e^2 = 0.
+
+		Unlike matrices, dual quaternions can be blended linearly without introducing scale or shear, which makes them well suited to skinning.
+		*/
+		template <typename NumericT = RealT>
+		class DualQuaternion {
+		public:
+			typedef Quaternion<NumericT> QuaternionT;
+			typedef Vector<3, NumericT> VectorT;
+
+			/// The rotation.
+			QuaternionT real;
+
+			/// Half the translation multiplied by the rotation.
+			QuaternionT dual;
+
+			/// Undefined constructor.
+			DualQuaternion () = default;
+
+			/// Identity constructor.
+			DualQuaternion (const Identity &) : real(IDENTITY), dual(Vector<4, NumericT>(ZERO)) {}
+
+			DualQuaternion (const QuaternionT & real_, const QuaternionT & dual_) : real(real_), dual(dual_) {}
+
+			/// Rotate and then translate, i.e. the same as Affine(translation, rotation).
+			DualQuaternion (const VectorT & translation, const QuaternionT & rotation) : real(rotation), dual(Vector<4, NumericT>(QuaternionT(translation.expand(0)) * rotation) * NumericT(0.5)) {}
+
+			/// Decompose a rigid transform, which must not contain any scale or shear.
+			DualQuaternion (const Affine<NumericT> & transform) : DualQuaternion(transform.translation(), transform.rotation()) {}
+
+			operator Affine<NumericT> () const {
+				return {translation(), real};
+			}
+
+			/// The rotation component.
+			QuaternionT rotation () const {
+				return real;
+			}
+
+			/// The translation component, i.e. where the origin is transformed to.
+			VectorT translation () const {
+				return (dual * real.conjugate()).reduce() * NumericT(2);
+			}
+
+			/// The conjugate, which is the inverse of a unit dual quaternion.
+			DualQuaternion conjugate () const {
+				return {real.conjugate(), dual.conjugate()};
+			}
+
+			/// Normalize the dual quaternion so that it represents a rigid transform again, e.g. after blending.
+			DualQuaternion normalize () const {
+				NumericT length = real.length();
+
+				Vector<4, NumericT> r = real / length, d = dual / length;
+
+				// Remove the component of the dual part which is not orthogonal to the real part:
+				return {QuaternionT(r), QuaternionT(d - r * NumericT(r.dot(d)))};
+			}
+
+			VectorT transform_point (const VectorT & point) const {
+				return rotate(real, point) + translation();
+			}
+
+			/// Transform a direction vector, ignoring the translation.
+			VectorT transform_vector (const VectorT & vector) const {
+				return rotate(real, vector);
+			}
+
+			bool equivalent (const DualQuaternion & other) const {
+				return real.equivalent(other.real) && dual.equivalent(other.dual);
+			}
+		};
+
+		typedef DualQuaternion<> DualQuat;
+
+		/// Compose two rigid transforms, i.e. the result applies right and then left.
+		template <typename NumericT>
+		DualQuaternion<NumericT> operator* (const DualQuaternion<NumericT> & left, const DualQuaternion<NumericT> & right)
+		{
+			return {left.real * right.real, Quaternion<NumericT>(Vector<4, NumericT>(left.real * right.dual) + Vector<4, NumericT>(left.dual * right.real))};
+		}
+
+		template <typename NumericT>
+		Vector<3, NumericT> operator* (const DualQuaternion<NumericT> & transform, const Vector<3, NumericT> & point)
+		{
+			return transform.transform_point(point);
+		}
+
+// MARK: -
+// MARK: Skinning
+
+		/// The bones which influence a vertex, as indices into a palette of transforms, and their weights, which should sum to one. Unused influences should have zero weight.
+		struct BoneInfluences {
+			static constexpr std::size_t COUNT = 4;
+
+			std::uint16_t bones[COUNT];
+			float weights[COUNT];
+		};
+
+		/// Blend the transforms of the bones which influence a vertex, using dual quaternion linear blending. The result must be normalized.
+		template <typename NumericT>
+		DualQuaternion<NumericT> blend (const DualQuaternion<NumericT> * palette, const BoneInfluences & influences)
+		{
+			const Quaternion<NumericT> & pivot = palette[influences.bones[0]].real;
+			Vector<4, NumericT> real(ZERO), dual(ZERO);
+
+			for (std::size_t i = 0; i < BoneInfluences::COUNT; i += 1) {
+				const DualQuaternion<NumericT> & bone = palette[influences.bones[i]];
+
+				// q and -q represent the same rotation, so every bone is blended in the same hemisphere as the first:
+				NumericT weight = bone.real.dot(pivot) < 0 ? -influences.weights[i] : influences.weights[i];
+
+				// Scale the components as vectors, since a quaternion times a scalar could also convert the scalar to a vector to rotate:
+				const Vector<4, NumericT> & bone_real = bone.real, & bone_dual = bone.dual;
+
+				real += bone_real * weight;
+				dual += bone_dual * weight;
+			}
+
+			return {Quaternion<NumericT>(real), Quaternion<NumericT>(dual)};
+		}
+
+		/// Skin an array of vertices, i.e. transform each position and normal by the blend of the bones which influence it. The positions and normals are read `stride` bytes apart, so that they can be members of an interleaved vertex, and the results are tightly packed.
+		template <typename NumericT>
+		void skin_vertices (const DualQuaternion<NumericT> * palette, const BoneInfluences * influences, const Vector<3, NumericT> * positions, const Vector<3, NumericT> * normals, std::size_t stride, Vector<3, NumericT> * skinned_positions, Vector<3, NumericT> * skinned_normals, std::size_t count)
+		{
+			auto position = reinterpret_cast<const unsigned char *>(positions), normal = reinterpret_cast<const unsigned char *>(normals);
+
+			for (std::size_t i = 0; i < count; i += 1) {
+				DualQuaternion<NumericT> transform = blend(palette, influences[i]).normalize();
+
+				skinned_positions[i] = transform.transform_point(*reinterpret_cast<const Vector<3, NumericT> *>(position + i * stride));
+				skinned_normals[i] = transform.transform_vector(*reinterpret_cast<const Vector<3, NumericT> *>(normal + i * stride));
+			}
+		}
+	}
+}
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// This is an optimised specialization which calls the best kernels for the selected instructions, see Instructions.hpp:
+		void skin_vertices(const DualQuaternion<float> * palette, const BoneInfluences * influences, const Vector<3, float> * positions, const Vector<3, float> * normals, std::size_t stride, Vector<3, float> * skinned_positions, Vector<3, float> * skinned_normals, std::size_t count);
+	}
+}
+
+#endif
+
+#endif
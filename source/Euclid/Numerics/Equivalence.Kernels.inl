@@ -0,0 +1,81 @@
+//
+//  Numerics/Equivalence.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The batch equivalence kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set.
+
+namespace {
+	template <std::size_t WIDTH>
+	inline unsigned equivalent_packed (const float * a, const float * b, const Tolerance<float> & tolerance)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		return equivalent_mask(PacketT::load(a), PacketT::load(b), tolerance);
+	}
+
+	template <std::size_t WIDTH>
+	inline void store_mask (unsigned mask, bool * result)
+	{
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			result[i] = (mask >> i) & 1;
+	}
+
+	/// The index of the first lane whose bit in mask is set, or WIDTH if there is none.
+	template <std::size_t WIDTH>
+	inline std::size_t first_lane (unsigned mask)
+	{
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			if ((mask >> i) & 1) return i;
+
+		return WIDTH;
+	}
+
+	/// Search WIDTH pairs at a time. A lane matches when its equivalence is the given value, which is the same as its bit in the mask, or the inverted mask.
+	template <std::size_t WIDTH>
+	inline bool find_packed (const float * a, const float * b, bool value, const Tolerance<float> & tolerance, std::size_t & index)
+	{
+		unsigned mask = equivalent_packed<WIDTH>(a, b, tolerance);
+
+		if (!value) mask = ~mask & ((1u << WIDTH) - 1);
+
+		if (mask) {
+			index += first_lane<WIDTH>(mask);
+			return true;
+		}
+
+		return false;
+	}
+}
+
+void equivalent(const float * a, const float * b, bool * result, std::size_t count, const Tolerance<float> & tolerance) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		store_mask<8>(equivalent_packed<8>(a + i, b + i, tolerance), result + i);
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		store_mask<4>(equivalent_packed<4>(a + i, b + i, tolerance), result + i);
+
+	for (; i < count; i += 1)
+		store_mask<1>(equivalent_packed<1>(a + i, b + i, tolerance), result + i);
+}
+
+std::size_t find_equivalent(const float * a, const float * b, std::size_t count, bool value, const Tolerance<float> & tolerance) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		if (find_packed<8>(a + i, b + i, value, tolerance, i)) return i;
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		if (find_packed<4>(a + i, b + i, value, tolerance, i)) return i;
+
+	for (; i < count; i += 1)
+		if (find_packed<1>(a + i, b + i, value, tolerance, i)) return i;
+
+	return count;
+}
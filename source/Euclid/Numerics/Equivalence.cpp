@@ -0,0 +1,23 @@
+//
+//  Numerics/Equivalence.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Equivalence.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		void equivalent(const float * a, const float * b, bool * result, std::size_t count, const Tolerance<float> & tolerance) {
+			EUCLID_NUMERICS_KERNELS_CALL(equivalent(a, b, result, count, tolerance))
+		}
+
+		std::size_t find_equivalent(const float * a, const float * b, std::size_t count, bool value, const Tolerance<float> & tolerance) {
+			EUCLID_NUMERICS_KERNELS_CALL(find_equivalent(a, b, count, value, tolerance))
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,143 @@
+//
+//  Numerics/Equivalence.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_EQUIVALENCE_H
+#define _EUCLID_NUMERICS_EQUIVALENCE_H
+
+#include "Matrix.hpp"
+#include "Float.hpp"
+#include "Instructions.hpp"
+
+#include <cstddef>
+#include <limits>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// The tolerance used to compare floating point numbers: an absolute epsilon when either number is smaller than one, and otherwise a number of units in the last place. The default is the same as Numerics::equivalent.
+		template <typename FloatT>
+		struct Tolerance {
+			typedef EpsilonTraits<FloatT, 0> DefaultT;
+			typedef typename DefaultT::UnitT UnitT;
+
+			/// The largest number of representable values between equivalent numbers, which must be less than 2^31.
+			UnitT units = DefaultT::UNITS;
+
+			/// The largest absolute difference between equivalent numbers near zero.
+			FloatT epsilon = DefaultT::EPSILON;
+
+			constexpr Tolerance () = default;
+
+			/// The same number of units in the last place, with the corresponding epsilon near zero.
+			constexpr Tolerance (UnitT units_) : units(units_), epsilon(std::numeric_limits<FloatT>::epsilon() * units_) {}
+
+			constexpr Tolerance (UnitT units_, FloatT epsilon_) : units(units_), epsilon(epsilon_) {}
+
+			bool equivalent (const FloatT & a, const FloatT & b) const
+			{
+				if (std::isnan(a) || std::isnan(b))
+					return false;
+
+				if (std::fabs(a) < DefaultT::SCALE || std::fabs(b) < DefaultT::SCALE)
+					return std::fabs(a - b) <= epsilon;
+				else if (std::signbit(a) != std::signbit(b))
+					return false;
+				else
+					return FloatEquivalenceTraits<FloatT>::integral_difference(a, b) <= units;
+			}
+		};
+
+		/// Compare two arrays element-wise, writing whether each pair is equivalent.
+		template <typename FloatT>
+		void equivalent (const FloatT * a, const FloatT * b, bool * result, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				result[i] = tolerance.equivalent(a[i], b[i]);
+		}
+
+		/// The index of the first pair whose equivalence is the given value, or count if there is none. The search stops as soon as one is found.
+		template <typename FloatT>
+		std::size_t find_equivalent (const FloatT * a, const FloatT * b, std::size_t count, bool value, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				if (tolerance.equivalent(a[i], b[i]) == value) return i;
+
+			return count;
+		}
+	}
+}
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		void equivalent(const float * a, const float * b, bool * result, std::size_t count, const Tolerance<float> & tolerance = Tolerance<float>());
+		std::size_t find_equivalent(const float * a, const float * b, std::size_t count, bool value, const Tolerance<float> & tolerance = Tolerance<float>());
+	}
+}
+
+#endif
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// The index of the first pair which isn't equivalent, or count if they all are, e.g. to report where two buffers differ.
+		template <typename FloatT>
+		std::size_t find_difference (const FloatT * a, const FloatT * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			return find_equivalent(a, b, count, false, tolerance);
+		}
+
+		/// Whether every pair is equivalent, which stops at the first difference.
+		template <typename FloatT>
+		bool all_equivalent (const FloatT * a, const FloatT * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			return find_equivalent(a, b, count, false, tolerance) == count;
+		}
+
+		/// Whether any pair is equivalent, which stops at the first one.
+		template <typename FloatT>
+		bool any_equivalent (const FloatT * a, const FloatT * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			return find_equivalent(a, b, count, true, tolerance) != count;
+		}
+
+		/// Vectors are compared component-wise, so arrays of them can be compared as arrays of numbers.
+		template <dimension E, typename FloatT>
+		bool all_equivalent (const Vector<E, FloatT> * a, const Vector<E, FloatT> * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			static_assert(sizeof(Vector<E, FloatT>) == sizeof(FloatT) * E, "Vector must be tightly packed!");
+
+			return all_equivalent(reinterpret_cast<const FloatT *>(a), reinterpret_cast<const FloatT *>(b), count * E, tolerance);
+		}
+
+		/// The index of the first vector which isn't equivalent, or count if they all are.
+		template <dimension E, typename FloatT>
+		std::size_t find_difference (const Vector<E, FloatT> * a, const Vector<E, FloatT> * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			return find_difference(reinterpret_cast<const FloatT *>(a), reinterpret_cast<const FloatT *>(b), count * E, tolerance) / E;
+		}
+
+		template <dimension R, dimension C, typename FloatT>
+		bool all_equivalent (const Matrix<R, C, FloatT> * a, const Matrix<R, C, FloatT> * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			static_assert(sizeof(Matrix<R, C, FloatT>) == sizeof(FloatT) * R * C, "Matrix must be tightly packed!");
+
+			return all_equivalent(reinterpret_cast<const FloatT *>(a), reinterpret_cast<const FloatT *>(b), count * R * C, tolerance);
+		}
+
+		/// The index of the first matrix which isn't equivalent, or count if they all are.
+		template <dimension R, dimension C, typename FloatT>
+		std::size_t find_difference (const Matrix<R, C, FloatT> * a, const Matrix<R, C, FloatT> * b, std::size_t count, const Tolerance<FloatT> & tolerance = Tolerance<FloatT>())
+		{
+			return find_difference(reinterpret_cast<const FloatT *>(a), reinterpret_cast<const FloatT *>(b), count * R * C, tolerance) / (R * C);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,269 @@
+//
+//  Numerics/Expression.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_EXPRESSION_H
+#define _EUCLID_NUMERICS_EXPRESSION_H
+
+#include "Numerics.hpp"
+#include "Vector.hpp"
+#include "Matrix.hpp"
+
+#include <type_traits>
+
+/** @file
+	Opt-in expression templates for Vector and Matrix arithmetic.
+
+	The standard operators evaluate one step at a time, so `a + b * s - c` creates a temporary vector for every operator. Wrapping an operand with lazy() builds the whole expression as a tree of lightweight nodes instead, which is evaluated in a single loop when it is assigned or converted to a Vector or Matrix:
+
+		Vec3 d = lazy(a) + lazy(b) * s - c;
+		d += lazy(a) * 2;
+
+	Normal precedence still applies, so in `lazy(a) + b * s` the product is evaluated eagerly before it is added; wrap `b` instead to fuse it. Expressions hold references to their operands, so they should be evaluated within the statement that created them. Storing one with `auto` is only safe while every operand, including any temporaries, is still alive.
+*/
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		template <typename ValueT>
+		struct ExpressionTraits;
+
+		template <dimension E, typename NumericT>
+		struct ExpressionTraits<Vector<E, NumericT>> {
+			static constexpr std::size_t SIZE = E;
+		};
+
+		template <dimension R, dimension C, typename NumericT>
+		struct ExpressionTraits<Matrix<R, C, NumericT>> {
+			static constexpr std::size_t SIZE = R * C;
+		};
+
+		/// Nodes of the expression tree. Each one computes a single element of the result on demand.
+		namespace Expressions
+		{
+			/// Refers to an existing Vector or Matrix.
+			template <typename ValueT>
+			struct Terminal {
+				const ValueT & value;
+
+				typename ValueT::value_type operator[] (std::size_t i) const { return value[i]; }
+			};
+
+			/// A single number which is applied to every element.
+			template <typename NumericT>
+			struct Scalar {
+				NumericT value;
+
+				NumericT operator[] (std::size_t) const { return value; }
+			};
+
+			/// Applies OperationT to the corresponding elements of both operands.
+			template <typename LeftT, typename RightT, typename OperationT>
+			struct Binary {
+				LeftT left;
+				RightT right;
+
+				auto operator[] (std::size_t i) const -> decltype(OperationT::apply(left[i], right[i])) { return OperationT::apply(left[i], right[i]); }
+			};
+
+			template <typename OperandT>
+			struct Negate {
+				OperandT operand;
+
+				auto operator[] (std::size_t i) const -> decltype(-operand[i]) { return -operand[i]; }
+			};
+
+			/// The product of a matrix and a vector. The vector is evaluated up front, since every row of the result depends on all of it.
+			template <dimension R, dimension C, typename NumericT, typename LeftT>
+			struct Product {
+				LeftT left;
+				Vector<C, NumericT> right;
+
+				NumericT operator[] (std::size_t r) const
+				{
+					NumericT result = 0;
+
+					for (dimension c = 0; c < C; c += 1)
+						result += left[c * R + r] * right[c];
+
+					return result;
+				}
+			};
+
+			/// Applies OperationT to every element of the result in turn. The recursion is fully unrolled, which allows the compiler to vectorize small expressions.
+			template <std::size_t I, std::size_t N>
+			struct Unroll {
+				template <typename OperationT, typename ResultT, typename NodeT>
+				static void apply (ResultT & result, const NodeT & node)
+				{
+					OperationT::apply(result[I], node[I]);
+					Unroll<I + 1, N>::template apply<OperationT>(result, node);
+				}
+			};
+
+			template <std::size_t N>
+			struct Unroll<N, N> {
+				template <typename OperationT, typename ResultT, typename NodeT>
+				static void apply (ResultT &, const NodeT &) {}
+			};
+
+			struct Assign { template <typename NumericT> static void apply (NumericT & a, const NumericT & b) { a = b; } };
+			struct AddAssign { template <typename NumericT> static void apply (NumericT & a, const NumericT & b) { a += b; } };
+			struct SubtractAssign { template <typename NumericT> static void apply (NumericT & a, const NumericT & b) { a -= b; } };
+			struct MultiplyAssign { template <typename NumericT> static void apply (NumericT & a, const NumericT & b) { a *= b; } };
+			struct DivideAssign { template <typename NumericT> static void apply (NumericT & a, const NumericT & b) { a /= b; } };
+
+			struct Add { template <typename NumericT> static NumericT apply (const NumericT & a, const NumericT & b) { return a + b; } };
+			struct Subtract { template <typename NumericT> static NumericT apply (const NumericT & a, const NumericT & b) { return a - b; } };
+			struct Multiply { template <typename NumericT> static NumericT apply (const NumericT & a, const NumericT & b) { return a * b; } };
+			struct Divide { template <typename NumericT> static NumericT apply (const NumericT & a, const NumericT & b) { return a / b; } };
+		}
+
+		/// An unevaluated expression which produces ValueT, a Vector or a Matrix. Elements are computed in storage order.
+		template <typename ValueT, typename NodeT>
+		struct Expression {
+			typedef typename ValueT::value_type NumericT;
+
+			static constexpr std::size_t SIZE = ExpressionTraits<ValueT>::SIZE;
+
+			NodeT node;
+
+			NumericT operator[] (std::size_t i) const { return node[i]; }
+
+			ValueT evaluate () const
+			{
+				ValueT result;
+
+				Expressions::Unroll<0, SIZE>::template apply<Expressions::Assign>(result, node);
+
+				return result;
+			}
+
+			operator ValueT () const { return evaluate(); }
+		};
+
+		/// Begin an expression which is evaluated lazily.
+		template <dimension E, typename NumericT>
+		Expression<Vector<E, NumericT>, Expressions::Terminal<Vector<E, NumericT>>> lazy (const Vector<E, NumericT> & value)
+		{
+			return {{value}};
+		}
+
+		/// Begin an expression which is evaluated lazily.
+		template <dimension R, dimension C, typename NumericT>
+		Expression<Matrix<R, C, NumericT>, Expressions::Terminal<Matrix<R, C, NumericT>>> lazy (const Matrix<R, C, NumericT> & value)
+		{
+			return {{value}};
+		}
+
+// MARK: -
+// MARK: Operators
+
+#define EUCLID_NUMERICS_EXPRESSION_OPERATOR(OP, OPERATION, TEMPLATE, VALUE) \
+		template <TEMPLATE, typename LeftT, typename RightT> \
+		Expression<VALUE, Expressions::Binary<LeftT, RightT, Expressions::OPERATION>> operator OP (const Expression<VALUE, LeftT> & left, const Expression<VALUE, RightT> & right) \
+		{ \
+			return {{left.node, right.node}}; \
+		} \
+		template <TEMPLATE, typename LeftT> \
+		Expression<VALUE, Expressions::Binary<LeftT, Expressions::Terminal<VALUE>, Expressions::OPERATION>> operator OP (const Expression<VALUE, LeftT> & left, const VALUE & right) \
+		{ \
+			return {{left.node, {right}}}; \
+		} \
+		template <TEMPLATE, typename RightT> \
+		Expression<VALUE, Expressions::Binary<Expressions::Terminal<VALUE>, RightT, Expressions::OPERATION>> operator OP (const VALUE & left, const Expression<VALUE, RightT> & right) \
+		{ \
+			return {{{left}, right.node}}; \
+		}
+
+#define EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR(OP, OPERATION) \
+		template <typename ValueT, typename LeftT, typename ScalarT, typename = typename std::enable_if<std::is_arithmetic<ScalarT>::value>::type> \
+		Expression<ValueT, Expressions::Binary<LeftT, Expressions::Scalar<typename ValueT::value_type>, Expressions::OPERATION>> operator OP (const Expression<ValueT, LeftT> & left, const ScalarT & right) \
+		{ \
+			return {{left.node, {typename ValueT::value_type(right)}}}; \
+		} \
+		template <typename ValueT, typename RightT, typename ScalarT, typename = typename std::enable_if<std::is_arithmetic<ScalarT>::value>::type> \
+		Expression<ValueT, Expressions::Binary<Expressions::Scalar<typename ValueT::value_type>, RightT, Expressions::OPERATION>> operator OP (const ScalarT & left, const Expression<ValueT, RightT> & right) \
+		{ \
+			return {{{typename ValueT::value_type(left)}, right.node}}; \
+		}
+
+#define EUCLID_NUMERICS_VECTOR_TEMPLATE dimension E, typename NumericT
+#define EUCLID_NUMERICS_VECTOR_VALUE Vector<E, NumericT>
+
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(+, Add, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(-, Subtract, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		// Element-wise multiplication and division are only defined for vectors, as matrix multiplication has a different meaning:
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(*, Multiply, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(/, Divide, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+
+#define EUCLID_NUMERICS_MATRIX_TEMPLATE dimension R, dimension C, typename NumericT
+#define EUCLID_NUMERICS_MATRIX_VALUE Matrix<R, C, NumericT>
+
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(+, Add, EUCLID_NUMERICS_MATRIX_TEMPLATE, EUCLID_NUMERICS_MATRIX_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(-, Subtract, EUCLID_NUMERICS_MATRIX_TEMPLATE, EUCLID_NUMERICS_MATRIX_VALUE)
+
+		// Scalars are applied to every element:
+		EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR(+, Add)
+		EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR(-, Subtract)
+		EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR(*, Multiply)
+		EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR(/, Divide)
+
+#undef EUCLID_NUMERICS_EXPRESSION_OPERATOR
+#undef EUCLID_NUMERICS_EXPRESSION_SCALAR_OPERATOR
+
+		template <typename ValueT, typename OperandT>
+		Expression<ValueT, Expressions::Negate<OperandT>> operator- (const Expression<ValueT, OperandT> & operand)
+		{
+			return {{operand.node}};
+		}
+
+		template <dimension R, dimension C, typename NumericT, typename LeftT, typename RightT>
+		Expression<Vector<R, NumericT>, Expressions::Product<R, C, NumericT, LeftT>> operator* (const Expression<Matrix<R, C, NumericT>, LeftT> & left, const Expression<Vector<C, NumericT>, RightT> & right)
+		{
+			return {{left.node, right.evaluate()}};
+		}
+
+		template <dimension R, dimension C, typename NumericT, typename LeftT>
+		Expression<Vector<R, NumericT>, Expressions::Product<R, C, NumericT, LeftT>> operator* (const Expression<Matrix<R, C, NumericT>, LeftT> & left, const Vector<C, NumericT> & right)
+		{
+			return {{left.node, right}};
+		}
+
+		template <dimension R, dimension C, typename NumericT, typename RightT>
+		Expression<Vector<R, NumericT>, Expressions::Product<R, C, NumericT, Expressions::Terminal<Matrix<R, C, NumericT>>>> operator* (const Matrix<R, C, NumericT> & left, const Expression<Vector<C, NumericT>, RightT> & right)
+		{
+			return {{{left}, right.evaluate()}};
+		}
+
+// MARK: -
+// MARK: Assignment
+
+#define EUCLID_NUMERICS_EXPRESSION_OPERATOR(OP, OPERATION, TEMPLATE, VALUE) \
+		template <TEMPLATE, typename NodeT> \
+		VALUE & operator OP (VALUE & lhs, const Expression<VALUE, NodeT> & rhs) \
+		{ \
+			Expressions::Unroll<0, ExpressionTraits<VALUE>::SIZE>::template apply<Expressions::OPERATION>(lhs, rhs.node); \
+			return lhs; \
+		}
+
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(+=, AddAssign, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(-=, SubtractAssign, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(*=, MultiplyAssign, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(/=, DivideAssign, EUCLID_NUMERICS_VECTOR_TEMPLATE, EUCLID_NUMERICS_VECTOR_VALUE)
+
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(+=, AddAssign, EUCLID_NUMERICS_MATRIX_TEMPLATE, EUCLID_NUMERICS_MATRIX_VALUE)
+		EUCLID_NUMERICS_EXPRESSION_OPERATOR(-=, SubtractAssign, EUCLID_NUMERICS_MATRIX_TEMPLATE, EUCLID_NUMERICS_MATRIX_VALUE)
+
+#undef EUCLID_NUMERICS_EXPRESSION_OPERATOR
+
+#undef EUCLID_NUMERICS_VECTOR_TEMPLATE
+#undef EUCLID_NUMERICS_VECTOR_VALUE
+#undef EUCLID_NUMERICS_MATRIX_TEMPLATE
+#undef EUCLID_NUMERICS_MATRIX_VALUE
+	}
+}
+
+#endif
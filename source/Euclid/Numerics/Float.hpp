@@ -101,7 +101,8 @@ namespace Euclid
 				if (i < j)
 					std::swap(i, j);
 
-				return i - j;
+				// The difference of two numbers with opposite signs may not fit in IntegralT, but always fits in UnsignedT:
+				return UnsignedT(i) - UnsignedT(j);
 			}
 
 			// Large MAX_DEVIATIONS may allow NAN to compare equivalent to large floating point numbers and other strange edge cases.
@@ -0,0 +1,307 @@
+//
+//  Numerics/GradientNoise.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "GradientNoise.hpp"
+
+#include <random>
+
+namespace Euclid {
+	namespace Numerics {
+		namespace {
+			/// The gradients are chosen by the hash of each corner, and point towards the edges of a square, cube or tesseract, so that no direction is favoured. The simplex noise is scaled so that it is approximately in [-1, 1], and the lattice is skewed by (sqrt(N + 1) - 1) / N and unskewed by (1 - 1 / sqrt(N + 1)) / N.
+			template <dimension E>
+			struct Gradients;
+
+			template <>
+			struct Gradients<2> {
+				static constexpr RealT SIMPLEX_SCALE = 70;
+				static constexpr RealT SKEW = 0.36602540378443864676, UNSKEW = 0.21132486540518711775;
+
+				static constexpr RealT VALUES[8][2] = {
+					{1, 1}, {-1, 1}, {1, -1}, {-1, -1},
+					{1, 0}, {-1, 0}, {0, 1}, {0, -1},
+				};
+			};
+
+			template <>
+			struct Gradients<3> {
+				static constexpr RealT SIMPLEX_SCALE = 76;
+				static constexpr RealT SKEW = 1.0 / 3.0, UNSKEW = 1.0 / 6.0;
+
+				// The 12 edges of a cube, and 4 of them again to make 16, as in Perlin's improved noise:
+				static constexpr RealT VALUES[16][3] = {
+					{1, 1, 0}, {-1, 1, 0}, {1, -1, 0}, {-1, -1, 0},
+					{1, 0, 1}, {-1, 0, 1}, {1, 0, -1}, {-1, 0, -1},
+					{0, 1, 1}, {0, -1, 1}, {0, 1, -1}, {0, -1, -1},
+					{1, 1, 0}, {-1, 1, 0}, {0, -1, 1}, {0, -1, -1},
+				};
+			};
+
+			template <>
+			struct Gradients<4> {
+				static constexpr RealT SIMPLEX_SCALE = 62;
+				static constexpr RealT SKEW = 0.30901699437494742410, UNSKEW = 0.13819660112501051518;
+
+				static constexpr RealT VALUES[32][4] = {
+					{0, 1, 1, 1}, {0, 1, 1, -1}, {0, 1, -1, 1}, {0, 1, -1, -1},
+					{0, -1, 1, 1}, {0, -1, 1, -1}, {0, -1, -1, 1}, {0, -1, -1, -1},
+					{1, 0, 1, 1}, {1, 0, 1, -1}, {1, 0, -1, 1}, {1, 0, -1, -1},
+					{-1, 0, 1, 1}, {-1, 0, 1, -1}, {-1, 0, -1, 1}, {-1, 0, -1, -1},
+					{1, 1, 0, 1}, {1, 1, 0, -1}, {1, -1, 0, 1}, {1, -1, 0, -1},
+					{-1, 1, 0, 1}, {-1, 1, 0, -1}, {-1, -1, 0, 1}, {-1, -1, 0, -1},
+					{1, 1, 1, 0}, {1, 1, -1, 0}, {1, -1, 1, 0}, {1, -1, -1, 0},
+					{-1, 1, 1, 0}, {-1, 1, -1, 0}, {-1, -1, 1, 0}, {-1, -1, -1, 0},
+				};
+			};
+
+			constexpr RealT Gradients<2>::VALUES[8][2];
+			constexpr RealT Gradients<3>::VALUES[16][3];
+			constexpr RealT Gradients<4>::VALUES[32][4];
+
+			template <dimension E>
+			inline const RealT * gradient_at (std::size_t hash)
+			{
+				typedef Gradients<E> GradientsT;
+
+				return GradientsT::VALUES[hash % (sizeof(GradientsT::VALUES) / sizeof(GradientsT::VALUES[0]))];
+			}
+
+			/// The largest integer not greater than the value, which is faster than std::floor where it isn't an instruction.
+			inline std::ptrdiff_t floor (RealT value)
+			{
+				std::ptrdiff_t result = std::ptrdiff_t(value);
+
+				return value < result ? result - 1 : result;
+			}
+
+			template <dimension E>
+			inline RealT dot (const RealT * gradient, const Vector<E> & offset)
+			{
+				RealT result = 0;
+
+				for (dimension i = 0; i < E; ++i)
+					result += gradient[i] * offset[i];
+
+				return result;
+			}
+		}
+
+		GradientNoise::GradientNoise(SeedT seed) {
+			std::mt19937 rng(seed);
+
+			for (std::size_t i = 0; i < 256; ++i) _permutation[i] = i;
+
+			// A Fisher-Yates shuffle, which unlike std::shuffle is the same for every standard library:
+			for (std::size_t i = 255; i > 0; --i)
+				std::swap(_permutation[i], _permutation[rng() % (i + 1)]);
+		}
+
+		template <dimension E>
+		std::size_t GradientNoise::hash (const Vector<E, std::ptrdiff_t> &cell) const {
+			std::size_t result = 0;
+
+			// Negative coordinates wrap around the permutation table:
+			for (dimension i = E; i-- > 0;)
+				result = _permutation[(result + std::size_t(cell[i])) & 255];
+
+			return result;
+		}
+
+		template <dimension E>
+		RealT GradientNoise::gradient_noise (const Vector<E> &at, Vector<E> *derivative) const {
+			const std::size_t CORNERS = 1 << E;
+
+			Vector<E, std::ptrdiff_t> cell;
+			Vector<E> t, fade, slope;
+
+			for (dimension i = 0; i < E; ++i) {
+				cell[i] = floor(at[i]);
+				t[i] = at[i] - cell[i];
+
+				// The quintic 6t^5 - 15t^4 + 10t^3, and its derivative 30t^2(t - 1)^2:
+				fade[i] = t[i] * t[i] * t[i] * (t[i] * (t[i] * 6 - 15) + 10);
+				slope[i] = 30 * t[i] * t[i] * (t[i] - 1) * (t[i] - 1);
+			}
+
+			// The hash of each corner, where bit i of the corner selects the upper side along axis i. The corners which differ only along the first axes share the hash of the remaining axes, so they are expanded one axis at a time, in place:
+			std::size_t hashes[CORNERS];
+			hashes[0] = 0;
+
+			for (dimension i = E; i-- > 0;) {
+				for (std::size_t corner = std::size_t(1) << (E - 1 - i); corner-- > 0;) {
+					std::size_t base = hashes[corner] + std::size_t(cell[i]);
+
+					hashes[corner * 2] = _permutation[base & 255];
+					hashes[corner * 2 + 1] = _permutation[(base + 1) & 255];
+				}
+			}
+
+			// The noise of each corner is the dot product of its gradient with the offset from the corner, and the derivative is the gradient:
+			RealT values[CORNERS];
+			Vector<E> derivatives[CORNERS];
+
+			for (std::size_t corner = 0; corner < CORNERS; ++corner) {
+				Vector<E> offset;
+
+				for (dimension i = 0; i < E; ++i)
+					offset[i] = t[i] - ((corner >> i) & 1);
+
+				const RealT * gradient = gradient_at<E>(hashes[corner]);
+				values[corner] = dot<E>(gradient, offset);
+
+				if (derivative)
+					derivatives[corner] = Vector<E>(gradient);
+			}
+
+			// Interpolate along one axis at a time, which halves the number of values, using the product rule for the derivatives:
+			for (dimension i = 0; i < E; ++i) {
+				for (std::size_t corner = 0; corner < (CORNERS >> (i + 1)); ++corner) {
+					RealT lower = values[corner * 2], upper = values[corner * 2 + 1];
+
+					values[corner] = lower + fade[i] * (upper - lower);
+
+					if (derivative) {
+						Vector<E> & lower_derivative = derivatives[corner * 2], & upper_derivative = derivatives[corner * 2 + 1];
+
+						for (dimension j = 0; j < E; ++j)
+							derivatives[corner][j] = lower_derivative[j] + fade[i] * (upper_derivative[j] - lower_derivative[j]);
+
+						derivatives[corner][i] += slope[i] * (upper - lower);
+					}
+				}
+			}
+
+			if (derivative)
+				*derivative = derivatives[0];
+
+			return values[0];
+		}
+
+		template <dimension E>
+		RealT GradientNoise::simplex_noise (const Vector<E> &at, Vector<E> *derivative) const {
+			// The factors which skew the lattice of simplices into a lattice of cubes, and back:
+			const RealT SKEW = Gradients<E>::SKEW, UNSKEW = Gradients<E>::UNSKEW;
+
+			// The squared radius of the contribution of each corner, which is small enough that the contributions are zero at the faces of the simplex, so the noise and its derivative are continuous:
+			const RealT RADIUS = 0.5;
+
+			RealT skew = 0;
+			for (dimension i = 0; i < E; ++i)
+				skew += at[i];
+			skew *= SKEW;
+
+			Vector<E, std::ptrdiff_t> cell;
+			RealT unskew = 0;
+
+			for (dimension i = 0; i < E; ++i) {
+				cell[i] = floor(at[i] + skew);
+				unskew += cell[i];
+			}
+
+			unskew *= UNSKEW;
+
+			// The offset from the first corner of the simplex, in the original space:
+			Vector<E> origin;
+			for (dimension i = 0; i < E; ++i)
+				origin[i] = at[i] - (cell[i] - unskew);
+
+			// The simplex is traversed by moving along each axis in order of decreasing offset, so the rank of each axis is the corner at which it moves:
+			Vector<E, std::size_t> rank;
+			for (dimension i = 0; i < E; ++i) {
+				rank[i] = 0;
+
+				for (dimension j = 0; j < E; ++j)
+					if (origin[j] > origin[i] || (origin[j] == origin[i] && j < i)) rank[i] += 1;
+			}
+
+			RealT value = 0;
+
+			if (derivative)
+				*derivative = ZERO;
+
+			for (std::size_t corner = 0; corner <= E; ++corner) {
+				Vector<E, std::ptrdiff_t> lattice;
+				Vector<E> offset;
+				RealT falloff = RADIUS;
+
+				for (dimension i = 0; i < E; ++i) {
+					bool moved = rank[i] < corner;
+
+					lattice[i] = cell[i] + moved;
+					offset[i] = origin[i] - moved + corner * UNSKEW;
+					falloff -= offset[i] * offset[i];
+				}
+
+				if (falloff <= 0) continue;
+
+				const RealT * gradient = gradient_at<E>(hash(lattice));
+				RealT n = dot<E>(gradient, offset);
+
+				RealT falloff2 = falloff * falloff, falloff4 = falloff2 * falloff2;
+
+				value += falloff4 * n;
+
+				// The derivative of falloff^4 * n, where the derivative of the falloff is -2 * offset:
+				if (derivative) {
+					for (dimension i = 0; i < E; ++i)
+						(*derivative)[i] += falloff4 * gradient[i] - 8 * falloff2 * falloff * n * offset[i];
+				}
+			}
+
+			if (derivative)
+				*derivative *= Gradients<E>::SIMPLEX_SCALE;
+
+			return value * Gradients<E>::SIMPLEX_SCALE;
+		}
+
+		RealT GradientNoise::gradient (const Vec2 &at) const {
+			return gradient_noise<2>(at, nullptr);
+		}
+
+		RealT GradientNoise::gradient (const Vec3 &at) const {
+			return gradient_noise<3>(at, nullptr);
+		}
+
+		RealT GradientNoise::gradient (const Vec4 &at) const {
+			return gradient_noise<4>(at, nullptr);
+		}
+
+		RealT GradientNoise::gradient (const Vec2 &at, Vec2 &derivative) const {
+			return gradient_noise<2>(at, &derivative);
+		}
+
+		RealT GradientNoise::gradient (const Vec3 &at, Vec3 &derivative) const {
+			return gradient_noise<3>(at, &derivative);
+		}
+
+		RealT GradientNoise::gradient (const Vec4 &at, Vec4 &derivative) const {
+			return gradient_noise<4>(at, &derivative);
+		}
+
+		RealT GradientNoise::simplex (const Vec2 &at) const {
+			return simplex_noise<2>(at, nullptr);
+		}
+
+		RealT GradientNoise::simplex (const Vec3 &at) const {
+			return simplex_noise<3>(at, nullptr);
+		}
+
+		RealT GradientNoise::simplex (const Vec4 &at) const {
+			return simplex_noise<4>(at, nullptr);
+		}
+
+		RealT GradientNoise::simplex (const Vec2 &at, Vec2 &derivative) const {
+			return simplex_noise<2>(at, &derivative);
+		}
+
+		RealT GradientNoise::simplex (const Vec3 &at, Vec3 &derivative) const {
+			return simplex_noise<3>(at, &derivative);
+		}
+
+		RealT GradientNoise::simplex (const Vec4 &at, Vec4 &derivative) const {
+			return simplex_noise<4>(at, &derivative);
+		}
+	}
+}
@@ -0,0 +1,56 @@
+//
+//  Numerics/GradientNoise.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_GRADIENT_NOISE_H
+#define _EUCLID_NUMERICS_GRADIENT_NOISE_H
+
+#include "Numerics.hpp"
+#include "Vector.hpp"
+
+namespace Euclid {
+	namespace Numerics {
+		/// Gradient and simplex noise in two, three and four dimensions. Unlike PerlinNoise, which interpolates random values, these interpolate random gradients, so the lattice is less visible. Each function can also compute the derivative of the noise with respect to the point, analytically, along with the value, e.g. to compute the normals of a height field without sampling the neighbouring points.
+		class GradientNoise {
+		protected:
+			unsigned char _permutation[256];
+
+		public:
+			typedef std::uint32_t SeedT;
+
+			/// The permutation only depends on the output of std::mt19937, so the noise is the same on every platform for a given seed.
+			GradientNoise(SeedT seed);
+
+			/// Perlin's improved noise, which interpolates the gradients at the 2^N corners of the lattice cell containing the point using a quintic curve, so the derivative is continuous. The result is approximately in [-1, 1].
+			RealT gradient (const Vec2 &at) const;
+			RealT gradient (const Vec3 &at) const;
+			RealT gradient (const Vec4 &at) const;
+
+			RealT gradient (const Vec2 &at, Vec2 &derivative) const;
+			RealT gradient (const Vec3 &at, Vec3 &derivative) const;
+			RealT gradient (const Vec4 &at, Vec4 &derivative) const;
+
+			/// Simplex noise, which sums the contributions of the N + 1 corners of the simplex containing the point, so it needs fewer lattice lookups than gradient noise: 3 rather than 4 in 2D, and 5 rather than 16 in 4D. The result is approximately in [-1, 1].
+			RealT simplex (const Vec2 &at) const;
+			RealT simplex (const Vec3 &at) const;
+			RealT simplex (const Vec4 &at) const;
+
+			RealT simplex (const Vec2 &at, Vec2 &derivative) const;
+			RealT simplex (const Vec3 &at, Vec3 &derivative) const;
+			RealT simplex (const Vec4 &at, Vec4 &derivative) const;
+
+		protected:
+			template <dimension E>
+			std::size_t hash (const Vector<E, std::ptrdiff_t> &cell) const;
+
+			template <dimension E>
+			RealT gradient_noise (const Vector<E> &at, Vector<E> *derivative) const;
+
+			template <dimension E>
+			RealT simplex_noise (const Vector<E> &at, Vector<E> *derivative) const;
+		};
+	}
+}
+
+#endif
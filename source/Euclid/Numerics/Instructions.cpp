@@ -0,0 +1,85 @@
+//
+//  Numerics/Instructions.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Instructions.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			Instructions detect_instructions ()
+			{
+#ifdef EUCLID_NUMERICS_DISPATCH
+				// This may run during static initialization, before the runtime has queried cpuid:
+				__builtin_cpu_init();
+
+				// These also check that the operating system saves the extended register state:
+				if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+					return Instructions::AVX2;
+
+				if (__builtin_cpu_supports("sse2"))
+					return Instructions::SSE2;
+#endif
+
+				return Instructions::GENERIC;
+			}
+
+			Instructions initial_instructions ()
+			{
+				Instructions instructions = supported_instructions();
+
+				if (const char * requested = std::getenv("EUCLID_INSTRUCTIONS")) {
+					for (auto candidate : {Instructions::GENERIC, Instructions::SSE2, Instructions::AVX2}) {
+						if (std::strcmp(requested, name(candidate)) == 0)
+							return std::min(candidate, instructions);
+					}
+				}
+
+				return instructions;
+			}
+
+			// Kernels which run before this is initialized see the zero value, i.e. GENERIC, which is always safe.
+			std::atomic<Instructions> _selected_instructions{initial_instructions()};
+		}
+
+		Instructions supported_instructions ()
+		{
+			static const Instructions instructions = detect_instructions();
+
+			return instructions;
+		}
+
+		Instructions selected_instructions ()
+		{
+			return _selected_instructions.load(std::memory_order_relaxed);
+		}
+
+		Instructions select_instructions (Instructions instructions)
+		{
+			instructions = std::min(instructions, supported_instructions());
+
+			_selected_instructions.store(instructions, std::memory_order_relaxed);
+
+			return instructions;
+		}
+
+		const char * name (Instructions instructions)
+		{
+			switch (instructions) {
+				case Instructions::SSE2: return "sse2";
+				case Instructions::AVX2: return "avx2";
+				default: return "generic";
+			}
+		}
+	}
+}
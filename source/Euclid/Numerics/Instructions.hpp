@@ -0,0 +1,63 @@
+//
+//  Numerics/Instructions.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_INSTRUCTIONS_H
+#define _EUCLID_NUMERICS_INSTRUCTIONS_H
+
+#include "Numerics.hpp"
+
+// On x86, optimised kernels are compiled for several instruction sets and the best one the processor supports is selected at run time:
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define EUCLID_NUMERICS_DISPATCH
+
+// Functions between BEGIN and END are compiled for AVX2 and FMA, regardless of the flags used for the rest of the library. Everything they depend on, including standard headers, must be included beforehand.
+#if defined(__clang__)
+#define EUCLID_NUMERICS_TARGET_AVX2_BEGIN _Pragma("clang attribute push (__attribute__((target(\"avx2,fma\"))), apply_to = function)")
+#define EUCLID_NUMERICS_TARGET_AVX2_END _Pragma("clang attribute pop")
+#else
+#define EUCLID_NUMERICS_TARGET_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma\")")
+#define EUCLID_NUMERICS_TARGET_AVX2_END _Pragma("GCC pop_options")
+#endif
+#endif
+
+// On ARM, NEON is always available where the compiler targets it, so those kernels are selected at compile time:
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define EUCLID_NUMERICS_NEON
+#endif
+
+// The public overloads which use the kernels written in terms of SIMD.inl are declared when either is available:
+#if defined(EUCLID_NUMERICS_DISPATCH) || defined(EUCLID_NUMERICS_NEON)
+#define EUCLID_NUMERICS_KERNELS
+#endif
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// Instruction sets which optimised kernels are compiled for, in increasing order of preference.
+		enum class Instructions
+		{
+			/// Plain C++, which the compiler may still vectorize using the flags the library was built with.
+			GENERIC = 0,
+			SSE2 = 1,
+			/// AVX2 with FMA, e.g. Haswell and later. Processors with AVX-512 also use these kernels.
+			AVX2 = 2,
+		};
+
+		/// The best instructions supported by the processor, detected using cpuid.
+		Instructions supported_instructions ();
+
+		/// The instructions which kernels are currently dispatched to. This is selected once at startup, and is the best supported unless overridden by setting the EUCLID_INSTRUCTIONS environment variable to generic, sse2 or avx2.
+		Instructions selected_instructions ();
+
+		/// Force kernels for specific instructions to be used, e.g. for testing or benchmarking. Instructions which the processor doesn't support are clamped to the best supported.
+		/// @returns the instructions which were actually selected.
+		Instructions select_instructions (Instructions instructions);
+
+		const char * name (Instructions instructions);
+	}
+}
+
+#endif
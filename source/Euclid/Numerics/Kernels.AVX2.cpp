@@ -0,0 +1,38 @@
+//
+//  Numerics/Kernels.AVX2.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+#include <cmath>
+#include <immintrin.h>
+
+#define EUCLID_NUMERICS_SIMD_AVX2
+
+EUCLID_NUMERICS_TARGET_AVX2_BEGIN
+
+namespace Euclid {
+	namespace Numerics {
+	namespace AVX2 {
+#include "SIMD.inl"
+#include "Matrix.Kernels.inl"
+#include "Affine.Kernels.inl"
+#include "Quaternion.Kernels.inl"
+#include "DualQuaternion.Kernels.inl"
+#include "Trigonometry.Kernels.inl"
+#include "Equivalence.Kernels.inl"
+#include "PerlinNoise.Kernels.inl"
+
+		namespace Lanes {
+#include "VectorArray.Kernels.inl"
+		}
+	}
+	}
+}
+
+EUCLID_NUMERICS_TARGET_AVX2_END
+
+#endif
@@ -0,0 +1,32 @@
+//
+//  Numerics/Kernels.Generic.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+#include <cmath>
+
+// The kernels are compiled with the scalar fallback, which is used when no SIMD instructions are selected, and checks the kernels themselves on any processor.
+namespace Euclid {
+	namespace Numerics {
+	namespace Generic {
+#include "SIMD.inl"
+#include "Matrix.Kernels.inl"
+#include "Affine.Kernels.inl"
+#include "Quaternion.Kernels.inl"
+#include "DualQuaternion.Kernels.inl"
+#include "Trigonometry.Kernels.inl"
+#include "Equivalence.Kernels.inl"
+#include "PerlinNoise.Kernels.inl"
+
+		namespace Lanes {
+#include "VectorArray.Kernels.inl"
+		}
+	}
+	}
+}
+
+#endif
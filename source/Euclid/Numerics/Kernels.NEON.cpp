@@ -0,0 +1,34 @@
+//
+//  Numerics/Kernels.NEON.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_NEON
+
+#include <cmath>
+#include <arm_neon.h>
+
+#define EUCLID_NUMERICS_SIMD_NEON
+
+namespace Euclid {
+	namespace Numerics {
+	namespace NEON {
+#include "SIMD.inl"
+#include "Matrix.Kernels.inl"
+#include "Affine.Kernels.inl"
+#include "Quaternion.Kernels.inl"
+#include "DualQuaternion.Kernels.inl"
+#include "Trigonometry.Kernels.inl"
+#include "Equivalence.Kernels.inl"
+#include "PerlinNoise.Kernels.inl"
+
+		namespace Lanes {
+#include "VectorArray.Kernels.inl"
+		}
+	}
+	}
+}
+
+#endif
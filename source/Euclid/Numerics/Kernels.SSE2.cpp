@@ -0,0 +1,34 @@
+//
+//  Numerics/Kernels.SSE2.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+#include <cmath>
+#include <emmintrin.h>
+
+#define EUCLID_NUMERICS_SIMD_SSE2
+
+namespace Euclid {
+	namespace Numerics {
+	namespace SSE2 {
+#include "SIMD.inl"
+#include "Matrix.Kernels.inl"
+#include "Affine.Kernels.inl"
+#include "Quaternion.Kernels.inl"
+#include "DualQuaternion.Kernels.inl"
+#include "Trigonometry.Kernels.inl"
+#include "Equivalence.Kernels.inl"
+#include "PerlinNoise.Kernels.inl"
+
+		namespace Lanes {
+#include "VectorArray.Kernels.inl"
+		}
+	}
+	}
+}
+
+#endif
@@ -0,0 +1,88 @@
+//
+//  Numerics/Kernels.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_KERNELS_H
+#define _EUCLID_NUMERICS_KERNELS_H
+
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Quaternion.Interpolate.hpp"
+#include "DualQuaternion.hpp"
+#include "Trigonometry.hpp"
+#include "Equivalence.hpp"
+#include "VectorArray.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+// The kernels which are written in terms of SIMD.inl, and compiled by Kernels.*.cpp for each instruction set:
+#define EUCLID_NUMERICS_KERNELS_DECLARE \
+	void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right); \
+	void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right); \
+	void multiply(Vector<4, double> & result, const Matrix<4, 4, double> & left, const Vector<4, double> & right); \
+	void multiply(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & left, const Matrix<4, 4, double> & right); \
+	void multiply(Matrix<4, 4, float> * result, const Matrix<4, 4, float> * left, const Matrix<4, 4, float> * right, std::size_t count); \
+	void transform_points(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count); \
+	void transform_points_projective(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count); \
+	void transform_vectors(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count); \
+	void multiply(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & left, const Matrix<3, 4, float> & right); \
+	void inverse(Matrix<3, 4, float> & result, const Matrix<3, 4, float> & source); \
+	Quaternion<float> multiply(const Quaternion<float> & q1, const Quaternion<float> & q2); \
+	Quaternion<double> multiply(const Quaternion<double> & q1, const Quaternion<double> & q2); \
+	void rotate_vectors(const Quaternion<float> & rotation, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count); \
+	void compose_quaternions(const Quaternion<float> * left, const Quaternion<float> * right, Quaternion<float> * output, std::size_t count); \
+	void compose_quaternions(const Quaternion<double> * left, const Quaternion<double> * right, Quaternion<double> * output, std::size_t count); \
+	void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, const float * factors, Quaternion<float> * output, std::size_t count); \
+	void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, float factor, Quaternion<float> * output, std::size_t count); \
+	void skin_vertices(const DualQuaternion<float> * palette, const BoneInfluences * influences, const Vector<3, float> * positions, const Vector<3, float> * normals, std::size_t stride, Vector<3, float> * skinned_positions, Vector<3, float> * skinned_normals, std::size_t count); \
+	void fast_sin_cos(const float * angles, float * sines, float * cosines, std::size_t count); \
+	void fast_acos(const float * values, float * angles, std::size_t count); \
+	void fast_atan2(const float * y, const float * x, float * angles, std::size_t count); \
+	void equivalent(const float * a, const float * b, bool * result, std::size_t count, const Tolerance<float> & tolerance); \
+	std::size_t find_equivalent(const float * a, const float * b, std::size_t count, bool value, const Tolerance<float> & tolerance); \
+	void sample_noise_grid(const float * table, const unsigned char * indices, const Vector<3, float> & origin, const Vector<3, float> & step, const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & dimensions, float scale, bool accumulate, float * output); \
+	namespace Lanes { \
+		EUCLID_NUMERICS_LANES_DECLARE(float) \
+		EUCLID_NUMERICS_LANES_DECLARE(double) \
+	}
+
+namespace Euclid {
+	namespace Numerics {
+#if defined(EUCLID_NUMERICS_DISPATCH)
+		namespace Generic {
+			EUCLID_NUMERICS_KERNELS_DECLARE
+		}
+
+		namespace SSE2 {
+			EUCLID_NUMERICS_KERNELS_DECLARE
+		}
+
+		namespace AVX2 {
+			EUCLID_NUMERICS_KERNELS_DECLARE
+		}
+#elif defined(EUCLID_NUMERICS_NEON)
+		namespace NEON {
+			EUCLID_NUMERICS_KERNELS_DECLARE
+		}
+#endif
+	}
+}
+
+#undef EUCLID_NUMERICS_KERNELS_DECLARE
+
+// Return the result of CALL using the kernels for the selected instructions:
+#if defined(EUCLID_NUMERICS_DISPATCH)
+#define EUCLID_NUMERICS_KERNELS_CALL(CALL) \
+	switch (selected_instructions()) { \
+		case Instructions::AVX2: return AVX2::CALL; \
+		case Instructions::SSE2: return SSE2::CALL; \
+		default: return Generic::CALL; \
+	}
+#elif defined(EUCLID_NUMERICS_NEON)
+#define EUCLID_NUMERICS_KERNELS_CALL(CALL) return NEON::CALL;
+#endif
+
+#endif
+
+#endif
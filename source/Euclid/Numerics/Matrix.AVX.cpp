@@ -0,0 +1,112 @@
+//
+//  Matrix.AVX.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Matrix.AVX.hpp"
+#include "Matrix.Multiply.hpp"
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+#include <immintrin.h>
+
+EUCLID_NUMERICS_TARGET_AVX2_BEGIN
+
+namespace Euclid {
+	namespace Numerics {
+	namespace AVX2 {
+		namespace {
+			// (v[X], v[Y], v[Z], v[W])
+			template <int X, int Y, int Z, int W>
+			inline __m256d swizzle(__m256d v) {
+				return _mm256_permute4x64_pd(v, _MM_SHUFFLE(W, Z, Y, X));
+			}
+
+			// (a[X], a[Y], b[Z], b[W])
+			template <int X, int Y, int Z, int W>
+			inline __m256d shuffle(__m256d a, __m256d b) {
+				return _mm256_blend_pd(swizzle<X, Y, X, Y>(a), swizzle<Z, W, Z, W>(b), 0xC);
+			}
+
+			inline __m256d sum(__m256d v) {
+				v = _mm256_add_pd(v, _mm256_permute2f128_pd(v, v, 0x01));
+				return _mm256_add_pd(v, _mm256_permute_pd(v, 0x5));
+			}
+
+			// The following operate on 2x2 matrices packed into a single register as (m00, m01, m10, m11).
+
+			// a * b
+			inline __m256d multiply_2x2(__m256d a, __m256d b) {
+				return _mm256_add_pd(_mm256_mul_pd(a, swizzle<0, 3, 0, 3>(b)), _mm256_mul_pd(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+			}
+
+			// adjugate(a) * b
+			inline __m256d adjugate_multiply_2x2(__m256d a, __m256d b) {
+				return _mm256_sub_pd(_mm256_mul_pd(swizzle<3, 3, 0, 0>(a), b), _mm256_mul_pd(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
+			}
+
+			// a * adjugate(b)
+			inline __m256d multiply_adjugate_2x2(__m256d a, __m256d b) {
+				return _mm256_sub_pd(_mm256_mul_pd(a, swizzle<3, 0, 3, 0>(b)), _mm256_mul_pd(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+			}
+
+		}
+
+		// This is an optimised specialization for AVX2, using the same block method as the SSE2 single precision version. It depends on the cross-lane permutes of AVX2, without which it is slower than the generic implementation.
+		void inverse(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & source) {
+			const double * m = source.data();
+
+			__m256d m0 = _mm256_loadu_pd(m), m1 = _mm256_loadu_pd(m + 4), m2 = _mm256_loadu_pd(m + 8), m3 = _mm256_loadu_pd(m + 12);
+
+			// | A B |
+			// | C D |
+			__m256d a = _mm256_permute2f128_pd(m0, m1, 0x20);
+			__m256d b = _mm256_permute2f128_pd(m0, m1, 0x31);
+			__m256d c = _mm256_permute2f128_pd(m2, m3, 0x20);
+			__m256d d = _mm256_permute2f128_pd(m2, m3, 0x31);
+
+			// (|A|, |B|, |C|, |D|)
+			__m256d determinants = _mm256_sub_pd(
+				_mm256_mul_pd(shuffle<0, 2, 0, 2>(m0, m2), shuffle<1, 3, 1, 3>(m1, m3)),
+				_mm256_mul_pd(shuffle<1, 3, 1, 3>(m0, m2), shuffle<0, 2, 0, 2>(m1, m3))
+			);
+
+			__m256d det_a = swizzle<0, 0, 0, 0>(determinants);
+			__m256d det_b = swizzle<1, 1, 1, 1>(determinants);
+			__m256d det_c = swizzle<2, 2, 2, 2>(determinants);
+			__m256d det_d = swizzle<3, 3, 3, 3>(determinants);
+
+			__m256d d_c = adjugate_multiply_2x2(d, c);
+			__m256d a_b = adjugate_multiply_2x2(a, b);
+
+			// The adjugates of the blocks of the result:
+			__m256d x = _mm256_sub_pd(_mm256_mul_pd(det_d, a), multiply_2x2(b, d_c));
+			__m256d w = _mm256_sub_pd(_mm256_mul_pd(det_a, d), multiply_2x2(c, a_b));
+			__m256d y = _mm256_sub_pd(_mm256_mul_pd(det_b, c), multiply_adjugate_2x2(d, a_b));
+			__m256d z = _mm256_sub_pd(_mm256_mul_pd(det_c, b), multiply_adjugate_2x2(a, d_c));
+
+			// |M| = |A||D| + |B||C| - trace(adjugate(A) * B * adjugate(D) * C)
+			__m256d determinant = _mm256_add_pd(_mm256_mul_pd(det_a, det_d), _mm256_mul_pd(det_b, det_c));
+			determinant = _mm256_sub_pd(determinant, sum(_mm256_mul_pd(a_b, swizzle<0, 2, 1, 3>(d_c))));
+
+			__m256d factor = _mm256_div_pd(_mm256_setr_pd(1, -1, -1, 1), determinant);
+
+			x = _mm256_mul_pd(x, factor);
+			y = _mm256_mul_pd(y, factor);
+			z = _mm256_mul_pd(z, factor);
+			w = _mm256_mul_pd(w, factor);
+
+			// Convert the blocks from adjugate form and store them:
+			double * r = result.data();
+			_mm256_storeu_pd(r, shuffle<3, 1, 3, 1>(x, y));
+			_mm256_storeu_pd(r + 4, shuffle<2, 0, 2, 0>(x, y));
+			_mm256_storeu_pd(r + 8, shuffle<3, 1, 3, 1>(z, w));
+			_mm256_storeu_pd(r + 12, shuffle<2, 0, 2, 0>(z, w));
+		}
+	}
+	}
+}
+
+EUCLID_NUMERICS_TARGET_AVX2_END
+
+#endif
@@ -0,0 +1,25 @@
+//
+//  Matrix.AVX.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_MATRIX_AVX_H
+#define _EUCLID_NUMERICS_MATRIX_AVX_H
+
+#include "Matrix.hpp"
+#include "Instructions.hpp"
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised implementations for AVX2 and FMA which aren't written in terms of SIMD.inl. They are compiled regardless of the flags used for the rest of the library, and selected at run time by Matrix.Dispatch.cpp:
+		namespace AVX2 {
+			void inverse(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & source);
+		}
+	}
+}
+
+#endif
+
+#endif
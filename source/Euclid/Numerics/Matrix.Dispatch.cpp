@@ -0,0 +1,79 @@
+//
+//  Numerics/Matrix.Dispatch.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Matrix.Dispatch.hpp"
+#include "Kernels.hpp"
+#include "Matrix.Inverse.hpp"
+#include "Matrix.SSE.hpp"
+#include "Matrix.AVX.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right))
+		}
+
+		void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right))
+		}
+
+		void multiply(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & left, const Matrix<4, 4, double> & right) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right))
+		}
+
+		void multiply(Vector<4, double> & result, const Matrix<4, 4, double> & left, const Vector<4, double> & right) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right))
+		}
+
+		void multiply(Matrix<4, 4, float> * result, const Matrix<4, 4, float> * left, const Matrix<4, 4, float> * right, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(result, left, right, count))
+		}
+
+		void transform_points(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(transform_points(transform, input, output, count))
+		}
+
+		void transform_points_projective(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(transform_points_projective(transform, input, output, count))
+		}
+
+		void transform_vectors(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(transform_vectors(transform, input, output, count))
+		}
+	}
+}
+
+#endif
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+namespace Euclid {
+	namespace Numerics {
+		void inverse(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source) {
+			if (selected_instructions() >= Instructions::SSE2)
+				return SSE2::inverse(result, source);
+
+			inverse<float>(result, source);
+		}
+
+		void inverse(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & source) {
+			if (selected_instructions() >= Instructions::AVX2)
+				return AVX2::inverse(result, source);
+
+			inverse<double>(result, source);
+		}
+
+		void inverse_affine(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source) {
+			if (selected_instructions() >= Instructions::SSE2)
+				return SSE2::inverse_affine(result, source);
+
+			inverse_affine<float>(result, source);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,44 @@
+//
+//  Numerics/Matrix.Dispatch.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_MATRIX_DISPATCH_H
+#define _EUCLID_NUMERICS_MATRIX_DISPATCH_H
+
+#include "Matrix.hpp"
+#include "Instructions.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right);
+		void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right);
+		void multiply(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & left, const Matrix<4, 4, double> & right);
+		void multiply(Vector<4, double> & result, const Matrix<4, 4, double> & left, const Vector<4, double> & right);
+
+		void multiply(Matrix<4, 4, float> * result, const Matrix<4, 4, float> * left, const Matrix<4, 4, float> * right, std::size_t count);
+
+		void transform_points(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count);
+		void transform_points_projective(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count);
+		void transform_vectors(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count);
+	}
+}
+
+#endif
+
+#ifdef EUCLID_NUMERICS_DISPATCH
+
+namespace Euclid {
+	namespace Numerics {
+		void inverse(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source);
+		void inverse(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & source);
+		void inverse_affine(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source);
+	}
+}
+
+#endif
+
+#endif
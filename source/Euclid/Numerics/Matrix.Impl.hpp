@@ -36,6 +36,12 @@ namespace Euclid
 			at(2, 1) =       2.0 * (y*z + w*x);
 			at(2, 2) = 1.0 - 2.0 * (x*x + y*y);
 		}
+
+		template <dimension R, dimension C, typename NumericT, typename QuaternionNumericT>
+		void compose (Matrix<R, C, NumericT> & to, const Quaternion<QuaternionNumericT> & rotation)
+		{
+			compose_rotation(to, Matrix<3, 3, NumericT>(rotation));
+		}
 	}
 }
 
@@ -11,6 +11,8 @@
 
 #include "Matrix.hpp"
 
+#include "Matrix.Dispatch.hpp"
+
 namespace Euclid {
 	namespace Numerics {
 		template <typename NumericT>
@@ -105,15 +107,83 @@ namespace Euclid {
 				dst[j] *= det;
 		}
 
+		template <typename NumericT>
+		void inverse (Matrix<4, 4, NumericT> & result, const Matrix<4, 4, NumericT> & source)
+		{
+			invert_matrix_4x4(source.data(), result.data());
+		}
+
+		/// Invert a matrix whose bottom row is (0, 0, 0, 1), e.g. any combination of rotations, translations and scales. This is considerably cheaper than the general inverse, but the result is undefined for projective matrices.
+		template <typename NumericT>
+		void inverse_affine (Matrix<4, 4, NumericT> & result, const Matrix<4, 4, NumericT> & source)
+		{
+			const NumericT * m = source.data();
+			NumericT * r = result.data();
+
+			// The rows of the inverse of the upper 3x3 are the cross products of its columns, divided by the determinant:
+			NumericT rows[3][3];
+
+			for (dimension i = 0; i < 3; i += 1) {
+				const NumericT * a = m + ((i + 1) % 3) * 4;
+				const NumericT * b = m + ((i + 2) % 3) * 4;
+
+				rows[i][0] = a[1] * b[2] - a[2] * b[1];
+				rows[i][1] = a[2] * b[0] - a[0] * b[2];
+				rows[i][2] = a[0] * b[1] - a[1] * b[0];
+			}
+
+			NumericT factor = NumericT(1) / (m[0] * rows[0][0] + m[1] * rows[0][1] + m[2] * rows[0][2]);
+
+			for (dimension c = 0; c < 3; c += 1) {
+				for (dimension i = 0; i < 3; i += 1)
+					r[c*4 + i] = rows[i][c] * factor;
+
+				r[c*4 + 3] = 0;
+			}
+
+			NumericT translation[3] = {m[12], m[13], m[14]};
+
+			for (dimension i = 0; i < 3; i += 1)
+				r[12 + i] = -(r[i] * translation[0] + r[4 + i] * translation[1] + r[8 + i] * translation[2]);
+
+			r[15] = 1;
+		}
+
 		template <typename NumericT>
 		Matrix<4, 4, NumericT> inverse (const Matrix<4, 4, NumericT> & source)
 		{
 			Matrix<4, 4, NumericT> result;
 
-			invert_matrix_4x4(source.data(), result.data());
+			inverse(result, source);
 			
 			return result;
 		}
+
+		template <typename NumericT>
+		Matrix<4, 4, NumericT> inverse_affine (const Matrix<4, 4, NumericT> & source)
+		{
+			Matrix<4, 4, NumericT> result;
+
+			inverse_affine(result, source);
+
+			return result;
+		}
+
+		/// Invert an array of matrices, i.e. result[i] = inverse(source[i]). The result may be the same array as the source.
+		template <typename NumericT>
+		void inverse (Matrix<4, 4, NumericT> * result, const Matrix<4, 4, NumericT> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				inverse(result[i], source[i]);
+		}
+
+		/// Invert an array of affine matrices, i.e. result[i] = inverse_affine(source[i]). The result may be the same array as the source.
+		template <typename NumericT>
+		void inverse_affine (Matrix<4, 4, NumericT> * result, const Matrix<4, 4, NumericT> * source, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				inverse_affine(result[i], source[i]);
+		}
 	}
 }
 
@@ -0,0 +1,156 @@
+//
+//  Numerics/Matrix.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The 4x4 matrix multiplication and batch transformation kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set.
+
+namespace {
+	/// Multiply the 4x4 matrix a by COLUMNS columns of b. Each column of the result is a linear combination of the columns of a. The results are computed into registers before they are stored, so r may alias a or b.
+	template <std::size_t COLUMNS, typename NumericT>
+	inline void multiply_columns (NumericT * r, const NumericT * a, const NumericT * b)
+	{
+		typedef Packet<NumericT, 4> PacketT;
+
+		PacketT a0 = PacketT::load(a), a1 = PacketT::load(a + 4), a2 = PacketT::load(a + 8), a3 = PacketT::load(a + 12);
+		PacketT columns[COLUMNS];
+
+		for (std::size_t i = 0; i < COLUMNS; i += 1) {
+			const NumericT * column = b + i*4;
+
+			columns[i] = a0 * PacketT::broadcast(column[0]);
+			columns[i] = multiply_add(a1, PacketT::broadcast(column[1]), columns[i]);
+			columns[i] = multiply_add(a2, PacketT::broadcast(column[2]), columns[i]);
+			columns[i] = multiply_add(a3, PacketT::broadcast(column[3]), columns[i]);
+		}
+
+		for (std::size_t i = 0; i < COLUMNS; i += 1)
+			columns[i].store(r + i*4);
+	}
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	typedef Packet<float, 8> PairT;
+
+	/// Given the columns of two left matrices packed into the halves of a, and a pair of right columns packed into b, compute the pair of result columns.
+	inline PairT combine (const PairT (&a)[4], const PairT & b)
+	{
+		PairT r = a[0] * b.swizzle<0, 0, 0, 0>();
+		r = multiply_add(a[1], b.swizzle<1, 1, 1, 1>(), r);
+		r = multiply_add(a[2], b.swizzle<2, 2, 2, 2>(), r);
+		return multiply_add(a[3], b.swizzle<3, 3, 3, 3>(), r);
+	}
+#endif
+
+	inline void multiply_matrix (float * r, const float * a, const float * b)
+	{
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		// Two columns of the result are computed per pass, so every column of the left matrix is duplicated into both halves:
+		const PairT columns[4] = {PairT::load_halves(a, a), PairT::load_halves(a + 4, a + 4), PairT::load_halves(a + 8, a + 8), PairT::load_halves(a + 12, a + 12)};
+
+		PairT r01 = combine(columns, PairT::load(b));
+		PairT r23 = combine(columns, PairT::load(b + 8));
+
+		r01.store(r);
+		r23.store(r + 8);
+#else
+		multiply_columns<4>(r, a, b);
+#endif
+	}
+
+	static_assert(sizeof(Vector<3, float>) == sizeof(float) * 3, "Vector<3, float> must be tightly packed!");
+
+	/// Transform WIDTH packed vectors by the column-major matrix m. When TRANSLATE is false, the vectors are treated as directions. When PROJECT is true, the result is divided by the homogeneous coordinate. The input is loaded before the output is stored, so they may alias.
+	template <bool TRANSLATE, bool PROJECT, std::size_t WIDTH>
+	inline void transform_packed (const float * m, const float * input, float * output)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		PacketT x, y, z;
+		load_vectors(input, x, y, z);
+
+		PacketT rows[4];
+
+		for (std::size_t r = 0; r < (PROJECT ? 4 : 3); r += 1) {
+			rows[r] = TRANSLATE ? multiply_add(PacketT::broadcast(m[r]), x, PacketT::broadcast(m[12 + r])) : PacketT::broadcast(m[r]) * x;
+			rows[r] = multiply_add(PacketT::broadcast(m[4 + r]), y, rows[r]);
+			rows[r] = multiply_add(PacketT::broadcast(m[8 + r]), z, rows[r]);
+		}
+
+		if (PROJECT) {
+			for (std::size_t r = 0; r < 3; r += 1)
+				rows[r] = rows[r] / rows[3];
+		}
+
+		store_vectors(output, rows[0], rows[1], rows[2]);
+	}
+
+	template <bool TRANSLATE, bool PROJECT>
+	void transform_batch (const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count)
+	{
+		const float * m = transform.data();
+		std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		for (; i + 8 <= count; i += 8)
+			transform_packed<TRANSLATE, PROJECT, 8>(m, input[i].data(), output[i].data());
+#endif
+
+		for (; i + 4 <= count; i += 4)
+			transform_packed<TRANSLATE, PROJECT, 4>(m, input[i].data(), output[i].data());
+
+		for (; i < count; i += 1)
+			transform_packed<TRANSLATE, PROJECT, 1>(m, input[i].data(), output[i].data());
+	}
+}
+
+void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right) {
+	multiply_columns<1>(result.data(), left.data(), right.data());
+}
+
+void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right) {
+	multiply_matrix(result.data(), left.data(), right.data());
+}
+
+void multiply(Vector<4, double> & result, const Matrix<4, 4, double> & left, const Vector<4, double> & right) {
+	multiply_columns<1>(result.data(), left.data(), right.data());
+}
+
+void multiply(Matrix<4, 4, double> & result, const Matrix<4, 4, double> & left, const Matrix<4, 4, double> & right) {
+	multiply_columns<4>(result.data(), left.data(), right.data());
+}
+
+void multiply(Matrix<4, 4, float> * result, const Matrix<4, 4, float> * left, const Matrix<4, 4, float> * right, std::size_t count) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	// Two matrices are multiplied per pass, the first in the low half of the registers and the second in the high half:
+	for (; i + 2 <= count; i += 2) {
+		const float * a = left[i].data(), * c = left[i+1].data();
+		const float * b = right[i].data(), * d = right[i+1].data();
+
+		const PairT columns[4] = {PairT::load_halves(a, c), PairT::load_halves(a + 4, c + 4), PairT::load_halves(a + 8, c + 8), PairT::load_halves(a + 12, c + 12)};
+		PairT products[4];
+
+		for (std::size_t j = 0; j < 4; j += 1)
+			products[j] = combine(columns, PairT::load_halves(b + j*4, d + j*4));
+
+		for (std::size_t j = 0; j < 4; j += 1)
+			products[j].store_halves(result[i].data() + j*4, result[i+1].data() + j*4);
+	}
+#endif
+
+	for (; i < count; i += 1)
+		multiply_matrix(result[i].data(), left[i].data(), right[i].data());
+}
+
+void transform_points(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+	transform_batch<true, false>(transform, input, output, count);
+}
+
+void transform_points_projective(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+	transform_batch<true, true>(transform, input, output, count);
+}
+
+void transform_vectors(const Matrix<4, 4, float> & transform, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+	transform_batch<false, false>(transform, input, output, count);
+}
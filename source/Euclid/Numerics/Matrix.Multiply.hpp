@@ -13,8 +13,7 @@
 #include "Angle.hpp"
 #include "Vector.Geometry.hpp"
 
-#include "Matrix.NEON.hpp"
-#include "Matrix.SSE.hpp"
+#include "Matrix.Dispatch.hpp"
 
 #include "Quaternion.hpp"
 
@@ -39,10 +38,11 @@ namespace Euclid {
 		 */
 
 		template <dimension R, dimension C, typename NumericT>
-		void multiply (Vector<R, NumericT> & result, const Matrix<R, C, NumericT> & left, const Vector<C, NumericT> & right)
+		constexpr void multiply (Vector<R, NumericT> & result, const Matrix<R, C, NumericT> & left, const Vector<C, NumericT> & right)
 		{
-			for (dimension r = 0; r < R; ++r)
-				for (dimension c = 0; c < C; ++c)
+			// Matrices are column-major, so iterating over columns first walks memory sequentially:
+			for (dimension c = 0; c < C; ++c)
+				for (dimension r = 0; r < R; ++r)
 					result[r] += right[c] * left.at(r, c);
 		}
 
@@ -62,7 +62,7 @@ namespace Euclid {
 		 */
 		
 		template <dimension R, dimension C, dimension T, typename NumericT>
-		void multiply (Matrix<R, C, NumericT> & result, const Matrix<R, T, NumericT> & left, const Matrix<T, C, NumericT> & top)
+		constexpr void multiply (Matrix<R, C, NumericT> & result, const Matrix<R, T, NumericT> & left, const Matrix<T, C, NumericT> & top)
 		{
 			for (dimension r = 0; r < R; ++r) {
 				for (dimension c = 0; c < C; ++c) {
@@ -74,44 +74,101 @@ namespace Euclid {
 			}
 		}
 
+		/// Multiply arrays of matrices, i.e. result[i] = left[i] * right[i].
+		template <dimension R, dimension C, dimension T, typename NumericT>
+		void multiply (Matrix<R, C, NumericT> * result, const Matrix<R, T, NumericT> * left, const Matrix<T, C, NumericT> * right, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				result[i] = ZERO;
+
+				multiply(result[i], left[i], right[i]);
+			}
+		}
+
+// MARK: -
+// MARK: Batch Transformation
+
+		/// Transform an array of points by an affine transform, i.e. output[i] = transform * input[i]. The bottom row of the transform is assumed to be (0, 0, 0, 1), so no perspective divide is performed. The output may be the same array as the input.
+		template <typename NumericT>
+		void transform_points (const Matrix<4, 4, NumericT> & transform, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				Vector<3, NumericT> point = input[i];
+
+				for (dimension r = 0; r < 3; ++r)
+					output[i][r] = transform.at(r, 0) * point[0] + transform.at(r, 1) * point[1] + transform.at(r, 2) * point[2] + transform.at(r, 3);
+			}
+		}
+
+		/// Transform an array of points by a projective transform, dividing each result by its homogeneous coordinate. The output may be the same array as the input.
+		template <typename NumericT>
+		void transform_points_projective (const Matrix<4, 4, NumericT> & transform, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				output[i] = transform * input[i];
+		}
+
+		/// Transform an array of direction vectors, ignoring the translation of the transform. The output may be the same array as the input.
+		template <typename NumericT>
+		void transform_vectors (const Matrix<4, 4, NumericT> & transform, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1) {
+				Vector<3, NumericT> vector = input[i];
+
+				for (dimension r = 0; r < 3; ++r)
+					output[i][r] = transform.at(r, 0) * vector[0] + transform.at(r, 1) * vector[1] + transform.at(r, 2) * vector[2];
+			}
+		}
+
 		/// Short-hand notation
 		template <dimension R, dimension C, typename NumericT>
-		Vector<C, NumericT> operator* (const Matrix<R, C, NumericT> & left, const Vector<R, NumericT> & right)
+		constexpr Vector<C, NumericT> operator* (const Matrix<R, C, NumericT> & left, const Vector<R, NumericT> & right)
 		{
 			Vector<R, NumericT> result(ZERO);
 
-			multiply(result, left, right);
+			if (EUCLID_CONSTANT_EVALUATED())
+				multiply<R, C, NumericT>(result, left, right);
+			else
+				multiply(result, left, right);
 
 			return result;
 		}
 
 		/// Short-hand notation for non-homogeneous vectors
 		template <dimension R, dimension C, typename NumericT>
-		Vector<C-1, NumericT> operator* (const Matrix<R, C, NumericT> & left, const Vector<R-1, NumericT> & right)
+		constexpr Vector<C-1, NumericT> operator* (const Matrix<R, C, NumericT> & left, const Vector<R-1, NumericT> & right)
 		{
 			Vector<C, NumericT> result(ZERO);
 
-			multiply(result, left, right << 1);
+			if (EUCLID_CONSTANT_EVALUATED())
+				multiply<R, C, NumericT>(result, left, right << 1);
+			else
+				multiply(result, left, right << 1);
 
-			result /= result[C-1];
+			// Affine transforms leave the homogeneous coordinate untouched:
+			if (result[C-1] != 1)
+				result /= result[C-1];
 
 			return result.reduce();
 		}
 
 		/// Short hand for matrix multiplication
 		template <dimension R, dimension C, dimension T, typename NumericT>
-		Matrix<R, C, NumericT> operator* (const Matrix<R, T, NumericT> & left, const Matrix<T, C, NumericT> & right)
+		constexpr Matrix<R, C, NumericT> operator* (const Matrix<R, T, NumericT> & left, const Matrix<T, C, NumericT> & right)
 		{
 			Matrix<R, C, NumericT> result(ZERO);
 
 			// For column-major matricies, the right hand transform is applied first when result * vector
-			multiply(result, left, right);
+			if (EUCLID_CONSTANT_EVALUATED())
+				multiply<R, C, T, NumericT>(result, left, right);
+			else
+				multiply(result, left, right);
 
 			return result;
 		}
 
 		template <dimension R, dimension C, typename NumericT>
-		Matrix<R, C, NumericT> & operator*= (Matrix<R, C, NumericT> & transform, const Matrix<R, C, NumericT> & step)
+		constexpr Matrix<R, C, NumericT> & operator*= (Matrix<R, C, NumericT> & transform, const Matrix<R, C, NumericT> & step)
 		{
 			return (transform = transform * step);
 		}
@@ -7,39 +7,137 @@
 //
 
 #include "Matrix.SSE.hpp"
+#include "Matrix.Multiply.hpp"
 
-#ifdef __SSE2__
+#ifdef EUCLID_NUMERICS_DISPATCH
 
-#include <xmmintrin.h>
+#include <emmintrin.h>
 
 namespace Euclid {
 	namespace Numerics {
-		// This is an optimised specialization for SSE2:
-		void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right) {
-			const float * a = left.data();
-			const float * b = right.data();
-			float * r = result.data();
+	namespace SSE2 {
+		namespace {
+			template <int X, int Y, int Z, int W>
+			inline __m128 swizzle(__m128 v) {
+				return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+			}
+
+			// (a[X], a[Y], b[Z], b[W])
+			template <int X, int Y, int Z, int W>
+			inline __m128 shuffle(__m128 a, __m128 b) {
+				return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X));
+			}
+
+			inline __m128 sum(__m128 v) {
+				v = _mm_add_ps(v, swizzle<2, 3, 0, 1>(v));
+				return _mm_add_ps(v, swizzle<1, 0, 3, 2>(v));
+			}
+
+			// The following operate on 2x2 matrices packed into a single register as (m00, m01, m10, m11).
+
+			// a * b
+			inline __m128 multiply_2x2(__m128 a, __m128 b) {
+				return _mm_add_ps(_mm_mul_ps(a, swizzle<0, 3, 0, 3>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+			}
 
-			__m128 a_line, b_line, r_line;
-			
-			for (int i=0; i<16; i+=4) {
-				// unroll the first step of the loop to avoid having to initialize r_line to zero
-				a_line = _mm_load_ps(a);         // a_line = vec4(column(a, 0))
-				b_line = _mm_set1_ps(b[i]);      // b_line = vec4(b[i][0])
-				r_line = _mm_mul_ps(a_line, b_line); // r_line = a_line * b_line
-				
-				for (int j=1; j<4; j++) {
-					a_line = _mm_load_ps(&a[j*4]); // a_line = vec4(column(a, j))
-					b_line = _mm_set1_ps(b[i+j]);  // b_line = vec4(b[i][j])
-					// r_line += a_line * b_line
-					r_line = _mm_add_ps(_mm_mul_ps(a_line, b_line), r_line);
-				}
-				_mm_store_ps(&r[i], r_line);     // r[i] = r_line
+			// adjugate(a) * b
+			inline __m128 adjugate_multiply_2x2(__m128 a, __m128 b) {
+				return _mm_sub_ps(_mm_mul_ps(swizzle<3, 3, 0, 0>(a), b), _mm_mul_ps(swizzle<1, 1, 2, 2>(a), swizzle<2, 3, 0, 1>(b)));
 			}
+
+			// a * adjugate(b)
+			inline __m128 multiply_adjugate_2x2(__m128 a, __m128 b) {
+				return _mm_sub_ps(_mm_mul_ps(a, swizzle<3, 0, 3, 0>(b)), _mm_mul_ps(swizzle<1, 0, 3, 2>(a), swizzle<2, 1, 2, 1>(b)));
+			}
+
+			inline __m128 cross_product(__m128 a, __m128 b) {
+				return _mm_sub_ps(_mm_mul_ps(swizzle<1, 2, 0, 3>(a), swizzle<2, 0, 1, 3>(b)), _mm_mul_ps(swizzle<2, 0, 1, 3>(a), swizzle<1, 2, 0, 3>(b)));
+			}
+		}
+
+		// This is an optimised specialization for SSE2. The matrix is partitioned into four 2x2 blocks which are inverted using their adjugates. The inverse of the transpose is the transpose of the inverse, so the same method works for column-major storage.
+		void inverse(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source) {
+			const float * m = source.data();
+
+			__m128 m0 = _mm_load_ps(m), m1 = _mm_load_ps(m + 4), m2 = _mm_load_ps(m + 8), m3 = _mm_load_ps(m + 12);
+
+			// | A B |
+			// | C D |
+			__m128 a = _mm_movelh_ps(m0, m1);
+			__m128 b = _mm_movehl_ps(m1, m0);
+			__m128 c = _mm_movelh_ps(m2, m3);
+			__m128 d = _mm_movehl_ps(m3, m2);
+
+			// (|A|, |B|, |C|, |D|)
+			__m128 determinants = _mm_sub_ps(
+				_mm_mul_ps(shuffle<0, 2, 0, 2>(m0, m2), shuffle<1, 3, 1, 3>(m1, m3)),
+				_mm_mul_ps(shuffle<1, 3, 1, 3>(m0, m2), shuffle<0, 2, 0, 2>(m1, m3))
+			);
+
+			__m128 det_a = swizzle<0, 0, 0, 0>(determinants);
+			__m128 det_b = swizzle<1, 1, 1, 1>(determinants);
+			__m128 det_c = swizzle<2, 2, 2, 2>(determinants);
+			__m128 det_d = swizzle<3, 3, 3, 3>(determinants);
+
+			__m128 d_c = adjugate_multiply_2x2(d, c);
+			__m128 a_b = adjugate_multiply_2x2(a, b);
+
+			// The adjugates of the blocks of the result:
+			__m128 x = _mm_sub_ps(_mm_mul_ps(det_d, a), multiply_2x2(b, d_c));
+			__m128 w = _mm_sub_ps(_mm_mul_ps(det_a, d), multiply_2x2(c, a_b));
+			__m128 y = _mm_sub_ps(_mm_mul_ps(det_b, c), multiply_adjugate_2x2(d, a_b));
+			__m128 z = _mm_sub_ps(_mm_mul_ps(det_c, b), multiply_adjugate_2x2(a, d_c));
+
+			// |M| = |A||D| + |B||C| - trace(adjugate(A) * B * adjugate(D) * C)
+			__m128 determinant = _mm_add_ps(_mm_mul_ps(det_a, det_d), _mm_mul_ps(det_b, det_c));
+			determinant = _mm_sub_ps(determinant, sum(_mm_mul_ps(a_b, swizzle<0, 2, 1, 3>(d_c))));
+
+			__m128 factor = _mm_div_ps(_mm_setr_ps(1, -1, -1, 1), determinant);
+
+			x = _mm_mul_ps(x, factor);
+			y = _mm_mul_ps(y, factor);
+			z = _mm_mul_ps(z, factor);
+			w = _mm_mul_ps(w, factor);
+
+			// Convert the blocks from adjugate form and store them:
+			float * r = result.data();
+			_mm_store_ps(r, shuffle<3, 1, 3, 1>(x, y));
+			_mm_store_ps(r + 4, shuffle<2, 0, 2, 0>(x, y));
+			_mm_store_ps(r + 8, shuffle<3, 1, 3, 1>(z, w));
+			_mm_store_ps(r + 12, shuffle<2, 0, 2, 0>(z, w));
 		}
 
-		//void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right) {
-		//}
+		// This is an optimised specialization for SSE2. The inverse of the upper 3x3 is computed from the cross products of its columns.
+		void inverse_affine(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source) {
+			const float * m = source.data();
+
+			__m128 c0 = _mm_load_ps(m), c1 = _mm_load_ps(m + 4), c2 = _mm_load_ps(m + 8), t = _mm_load_ps(m + 12);
+
+			__m128 r0 = cross_product(c1, c2);
+			__m128 r1 = cross_product(c2, c0);
+			__m128 r2 = cross_product(c0, c1);
+			__m128 r3 = _mm_setzero_ps();
+
+			__m128 factor = _mm_div_ps(_mm_set1_ps(1), sum(_mm_mul_ps(c0, r0)));
+
+			r0 = _mm_mul_ps(r0, factor);
+			r1 = _mm_mul_ps(r1, factor);
+			r2 = _mm_mul_ps(r2, factor);
+
+			// The rows of the inverse were computed, so transpose them into columns:
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+			__m128 translation = _mm_mul_ps(r0, swizzle<0, 0, 0, 0>(t));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r1, swizzle<1, 1, 1, 1>(t)));
+			translation = _mm_add_ps(translation, _mm_mul_ps(r2, swizzle<2, 2, 2, 2>(t)));
+
+			float * r = result.data();
+			_mm_store_ps(r, r0);
+			_mm_store_ps(r + 4, r1);
+			_mm_store_ps(r + 8, r2);
+			_mm_store_ps(r + 12, _mm_sub_ps(_mm_setr_ps(0, 0, 0, 1), translation));
+		}
+	}
 	}
 }
 
@@ -10,14 +10,17 @@
 #define _EUCLID_NUMERICS_MATRIX_SSE_H
 
 #include "Matrix.hpp"
+#include "Instructions.hpp"
 
-#ifdef __SSE2__
+#ifdef EUCLID_NUMERICS_DISPATCH
 
 namespace Euclid {
 	namespace Numerics {
-		// This is an optimised specialization for SSE2:
-		void multiply(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & left, const Matrix<4, 4, float> & right);
-		//void multiply(Vector<4, float> & result, const Matrix<4, 4, float> & left, const Vector<4, float> & right);
+		// These are optimised implementations for SSE2 which aren't written in terms of SIMD.inl. They are selected at run time by Matrix.Dispatch.cpp:
+		namespace SSE2 {
+			void inverse(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source);
+			void inverse_affine(Matrix<4, 4, float> & result, const Matrix<4, 4, float> & source);
+		}
 	}
 }
 
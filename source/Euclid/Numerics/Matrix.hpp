@@ -24,6 +24,9 @@ namespace Euclid
 		template <typename NumericT>
 		class Quaternion;
 
+		template <typename NumericT>
+		class Affine;
+
 // MARK: -
 // MARK: Matrix Class
 
@@ -44,40 +47,43 @@ namespace Euclid
 			// Uninitialized constructor
 			Matrix () = default;
 
-			Matrix (const NumericT & identity) {
-				this->fill(0);
-
+			constexpr Matrix (const NumericT & identity) : std::array<NumericT, R*C>() {
 				if (identity == 0) return;
 
 				for (dimension i = 0; i < std::min(R, C); i += 1)
 					at(i, i) = identity;
 			}
 
-			Matrix (const Matrix & other) : std::array<NumericT, R*C>(other) {}
+			constexpr Matrix (const Matrix & other) : std::array<NumericT, R*C>(other) {}
 
 			template <typename QuaternionNumericT>
 			Matrix (const Quaternion<QuaternionNumericT> & rotation);
 
+			/// Expand an affine transform, defined in Affine.hpp, with the implicit bottom row (0, 0, 0, 1).
+			template <typename AffineNumericT>
+			Matrix (const Affine<AffineNumericT> & transform);
+
 			template <typename... TailT>
-			Matrix (const NumericT & head, const TailT&&... tail) : std::array<NumericT, R*C>{{head, (NumericT)tail...}} {}
+			constexpr Matrix (const NumericT & head, const TailT&&... tail) : std::array<NumericT, R*C>{{head, (NumericT)tail...}} {}
 
+			/// Copy the overlapping region of another matrix. Elements outside of it are zero.
 			template <dimension S, dimension T, typename OtherNumericT>
-			Matrix (const Matrix<S, T, OtherNumericT> & other) {
-				for (std::size_t t = 0; t < std::min(C, T); t += 1) {
-					auto column = &other.at(0, t);
-					std::copy(column, column + std::min(R, S), &at(0, t));
-				}
+			constexpr Matrix (const Matrix<S, T, OtherNumericT> & other) : std::array<NumericT, R*C>() {
+				for (dimension t = 0; t < std::min(C, T); t += 1)
+					for (dimension s = 0; s < std::min(R, S); s += 1)
+						at(s, t) = other.at(s, t);
 			}
 
 			template <typename OtherNumericT>
-			Matrix (const OtherNumericT (&data)[R*C])
+			constexpr Matrix (const OtherNumericT (&data)[R*C]) : std::array<NumericT, R*C>()
 			{
-				std::copy(data, data + R*C, this->begin());
+				for (dimension i = 0; i < R*C; i += 1)
+					(*this)[i] = data[i];
 			}
 
 			// Transform Constructors:
 			template <dimension N, typename AxisNumericT>
-			Matrix(const Translation<N, AxisNumericT> & translation) : Matrix(IDENTITY)
+			constexpr Matrix(const Translation<N, AxisNumericT> & translation) : Matrix(IDENTITY)
 			{
 				for (dimension i = 0; i < std::min(R, N); i += 1) {
 					at(i, C-1) = translation.offset[i];
@@ -85,7 +91,7 @@ namespace Euclid
 			}
 
 			template <dimension N>
-			Matrix(const Scale<N, NumericT> & scale) : Matrix(IDENTITY)
+			constexpr Matrix(const Scale<N, NumericT> & scale) : Matrix(IDENTITY)
 			{
 				for (dimension i = 0; i < N; i += 1) {
 					at(i, i) = scale.factor[i];
@@ -93,7 +99,7 @@ namespace Euclid
 			}
 
 			template <dimension K = 1, typename ScaleFactorT>
-			Matrix(const UniformScale<ScaleFactorT> & scale) : Matrix(IDENTITY)
+			constexpr Matrix(const UniformScale<ScaleFactorT> & scale) : Matrix(IDENTITY)
 			{
 				for (dimension i = 0; i < std::min(R, C) - K; i += 1) {
 					at(i, i) = scale.factor;
@@ -180,8 +186,9 @@ namespace Euclid
 				}
 			}
 
+			/// Evaluate a chain of transforms. Chains of translations and scales can be evaluated at compile time.
 			template <typename A, typename B>
-			Matrix (const Transforms<A, B> & transforms) : Matrix(IDENTITY)
+			constexpr Matrix (const Transforms<A, B> & transforms) : Matrix(IDENTITY)
 			{
 				transforms.apply(*this);
 			}
@@ -192,19 +199,20 @@ namespace Euclid
 				std::copy(data, data + (R*C), this->begin());
 			}
 
-			std::size_t offset(std::size_t row, std::size_t column) const {
+			constexpr std::size_t offset(std::size_t row, std::size_t column) const {
 				assert(row < R && column < C);
 				
-				return column_major_offset(row, column, R);
+				// Column-major, consistent with column_major_offset:
+				return column * R + row;
 			}
 
 			// Accessors
-			const NumericT & at (dimension r, dimension c) const
+			constexpr const NumericT & at (dimension r, dimension c) const
 			{
 				return (*this)[offset(r, c)];
 			}
 
-			NumericT & at (dimension r, dimension c)
+			constexpr NumericT & at (dimension r, dimension c)
 			{
 				return (*this)[offset(r, c)];
 			}
@@ -232,9 +240,9 @@ namespace Euclid
 			}
 
 			/// Return a copy of this matrix, transposed.
-			Matrix<C, R, NumericT> transpose () const
+			constexpr Matrix<C, R, NumericT> transpose () const
 			{
-				Matrix<C, R, NumericT> result;
+				Matrix<C, R, NumericT> result(ZERO);
 
 				for (dimension c = 0; c < C; ++c)
 					for (dimension r = 0; r < R; ++r)
@@ -255,12 +263,99 @@ namespace Euclid
 			}
 
 			template <typename RightT>
-			Transforms<Matrix, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<Matrix, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
 		};
 
+// MARK: -
+// MARK: Transform Composition
+
+		/// Right-multiply by a translation in place. Only the last column changes, so this is much cheaper than a full matrix multiplication, and can be evaluated at compile time.
+		template <dimension R, dimension C, typename NumericT, dimension N, typename AxisNumericT>
+		constexpr void compose (Matrix<R, C, NumericT> & to, const Translation<N, AxisNumericT> & translation)
+		{
+			for (dimension r = 0; r < R; r += 1) {
+				NumericT value = 0;
+
+				for (dimension k = 0; k < C; k += 1)
+					value += to.at(r, k) * (k < std::min(R, N) ? NumericT(translation.offset[k]) : NumericT(k == C-1));
+
+				to.at(r, C-1) = value;
+			}
+		}
+
+		/// Right-multiply by a scale in place, which scales the corresponding columns.
+		template <dimension R, dimension C, typename NumericT, dimension N>
+		constexpr void compose (Matrix<R, C, NumericT> & to, const Scale<N, NumericT> & scale)
+		{
+			for (dimension c = 0; c < N; c += 1)
+				for (dimension r = 0; r < R; r += 1)
+					to.at(r, c) *= scale.factor[c];
+		}
+
+		/// Right-multiply by a uniform scale in place, which scales all but the last column.
+		template <dimension R, dimension C, typename NumericT, typename ScaleFactorT>
+		constexpr void compose (Matrix<R, C, NumericT> & to, const UniformScale<ScaleFactorT> & scale)
+		{
+			for (dimension c = 0; c < std::min(R, C - 1); c += 1)
+				for (dimension r = 0; r < R; r += 1)
+					to.at(r, c) *= scale.factor;
+		}
+
+		/// Right-multiply by a rotation around a fixed axis in place. Only the two columns spanning the plane of rotation change.
+		template <dimension R, dimension C, typename NumericT, dimension AXIS, typename AngleNumericT>
+		void compose (Matrix<R, C, NumericT> & to, const FixedAxisRotation<AXIS, AngleNumericT> & rotation)
+		{
+			// The rotation maps axis I towards axis J, e.g. for Z, X towards Y:
+			constexpr dimension I = (AXIS + 1) % 3, J = (AXIS + 2) % 3;
+			static_assert(R > std::max(I, J) && C > std::max(I, J), "Matrix is too small for rotation around this axis!");
+
+			NumericT c = rotation.angle.cos();
+			NumericT s = rotation.angle.sin();
+
+			for (dimension r = 0; r < R; r += 1) {
+				NumericT a = to.at(r, I), b = to.at(r, J);
+
+				to.at(r, I) = a * c + b * s;
+				to.at(r, J) = b * c - a * s;
+			}
+		}
+
+		/// Right-multiply by a rotation around an origin, i.e. translate(-origin) << rotation << translate(origin).
+		template <dimension R, dimension C, typename NumericT, dimension N, typename AngleNumericT, typename AxisNumericT>
+		void compose (Matrix<R, C, NumericT> & to, const OffsetAngleAxisRotation<N, AngleNumericT, AxisNumericT> & offset_rotation)
+		{
+			if (offset_rotation.origin.equivalent(0)) {
+				compose(to, offset_rotation.rotation);
+			} else {
+				compose(to, translate(-offset_rotation.origin));
+				compose(to, offset_rotation.rotation);
+				compose(to, translate(offset_rotation.origin));
+			}
+		}
+
+		/// Right-multiply by a 3x3 rotation, extended with the identity, in place. Only the first three columns change.
+		template <dimension R, dimension C, typename NumericT>
+		void compose_rotation (Matrix<R, C, NumericT> & to, const Matrix<3, 3, NumericT> & rotation)
+		{
+			static_assert(C >= 3, "Matrix must be at least 3 columns to contain rotation!");
+
+			for (dimension r = 0; r < R; r += 1) {
+				NumericT a = to.at(r, 0), b = to.at(r, 1), c = to.at(r, 2);
+
+				for (dimension j = 0; j < 3; j += 1)
+					to.at(r, j) = a * rotation.at(0, j) + b * rotation.at(1, j) + c * rotation.at(2, j);
+			}
+		}
+
+		template <dimension R, dimension C, typename NumericT, dimension N, typename AngleNumericT, typename AxisNumericT>
+		void compose (Matrix<R, C, NumericT> & to, const AngleAxisRotation<N, AngleNumericT, AxisNumericT> & rotation)
+		{
+			compose_rotation(to, Matrix<3, 3, NumericT>(rotation));
+		}
+
 // MARK: -
 // MARK: Static Matrix Constructors
 
@@ -10,6 +10,7 @@
 #define _EUCLID_NUMERICS_NUMBER_ANGLES_H
 
 #include "Angle.hpp"
+#include "Trigonometry.hpp"
 
 namespace Euclid
 {
@@ -32,6 +33,12 @@ namespace Euclid
 		{
 			return Radians<RealT>{std::atan(value)};
 		}
+
+		template <typename NumericT>
+		auto Number<NumericT>::fast_acos () -> Radians<RealT>
+		{
+			return Radians<RealT>{Numerics::fast_acos<RealT>(value)};
+		}
 	}
 }
 
@@ -106,12 +106,12 @@ namespace Euclid
 			{
 			}
 
-			operator NumericT & ()
+			constexpr operator NumericT & ()
 			{
 				return value;
 			}
 
-			operator const NumericT & () const
+			constexpr operator const NumericT & () const
 			{
 				return value;
 			}
@@ -206,6 +206,9 @@ namespace Euclid
 			Radians<RealT> acos();
 			Radians<RealT> atan();
 
+			/// A fast approximation of acos, see Trigonometry.hpp.
+			Radians<RealT> fast_acos();
+
 			template <typename OtherNumericT>
 			Number<OtherNumericT> as()
 			{
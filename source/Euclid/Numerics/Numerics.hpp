@@ -16,6 +16,17 @@
 #include <cstdint>
 #include <type_traits>
 
+// Optimised specializations, e.g. using SIMD intrinsics, can't be evaluated at compile time. Where the compiler can tell us, generic implementations are used during constant evaluation instead:
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define EUCLID_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+#endif
+
+#ifndef EUCLID_CONSTANT_EVALUATED
+#define EUCLID_CONSTANT_EVALUATED() false
+#endif
+
 namespace Euclid
 {
 	/// Mathematics and functionality directly associated with numbers.
@@ -0,0 +1,123 @@
+//
+//  Numerics/PerlinNoise.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The noise grid kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set. The packets have no integer operations, so the permutation table is gathered into lanes with scalar loads, and the interpolation is evaluated in packets.
+
+namespace {
+	/// The lattice cell and fraction of a point along the x axis, which are the same for every row of the grid. The cell is relative to the first cell of the row, modulo the size of the permutation table.
+	struct NoiseLattice {
+		std::size_t cell;
+		float fraction;
+	};
+
+	/// Gather the noise at the corners of the cells of WIDTH points along a row, where values holds the noise at the four (y, z) corners of each cell of the row, in the same order as PerlinNoise::sample.
+	template <std::size_t WIDTH>
+	inline void gather_noise (const float * values, const NoiseLattice * lattice, float (& corners)[2][4][WIDTH], float (& fractions)[WIDTH])
+	{
+		for (std::size_t lane = 0; lane < WIDTH; lane += 1) {
+			const float * cell = values + lattice[lane].cell * 4;
+
+			fractions[lane] = lattice[lane].fraction;
+
+			for (std::size_t corner = 0; corner < 4; corner += 1) {
+				corners[0][corner][lane] = cell[corner];
+				corners[1][corner][lane] = cell[corner + 4];
+			}
+		}
+	}
+
+	/// Evaluate WIDTH points along a row by interpolating the noise at the corners of their cells.
+	template <std::size_t WIDTH>
+	inline void noise_packed (const float * values, const NoiseLattice * lattice, const float * fractions, float scale, bool accumulate, float * output)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		float corners[2][4][WIDTH], tx[WIDTH];
+		gather_noise<WIDTH>(values, lattice, corners, tx);
+
+		PacketT one = PacketT::broadcast(1);
+		PacketT t = PacketT::load(tx), u = one - t;
+
+		PacketT x[4];
+		for (std::size_t corner = 0; corner < 4; corner += 1)
+			x[corner] = PacketT::load(corners[0][corner]) * u + PacketT::load(corners[1][corner]) * t;
+
+		PacketT ty = PacketT::broadcast(fractions[0]), tz = PacketT::broadcast(fractions[1]);
+
+		PacketT y0 = x[0] * (one - ty) + x[1] * ty;
+		PacketT y1 = x[2] * (one - ty) + x[3] * ty;
+
+		PacketT result = (y0 * (one - tz) + y1 * tz) * PacketT::broadcast(scale);
+
+		if (accumulate)
+			result = PacketT::load(output) + result;
+
+		result.store(output);
+	}
+}
+
+void sample_noise_grid(const float * table, const unsigned char * indices, const Vector<3, float> & origin, const Vector<3, float> & step, const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & dimensions, float scale, bool accumulate, float * output) {
+	if (dimensions[X] == 0) return;
+
+	std::vector<std::ptrdiff_t> cells(dimensions[X]);
+	std::vector<NoiseLattice> lattice(dimensions[X]);
+
+	for (std::size_t x = 0; x < dimensions[X]; x += 1) {
+		float position = origin[X] + step[X] * float(offset[X] + x), floor = std::floor(position);
+
+		cells[x] = std::ptrdiff_t(floor);
+		lattice[x].fraction = position - floor;
+	}
+
+	// The cells are monotonic, so the row spans the cells between the first and the last:
+	std::ptrdiff_t first = std::min(cells.front(), cells.back()), last = std::max(cells.front(), cells.back());
+
+	// The permutation table repeats every 256 cells, which bounds the cells of a long row:
+	for (std::size_t x = 0; x < dimensions[X]; x += 1)
+		lattice[x].cell = std::size_t(cells[x] - first) & 255;
+
+	// The noise at the corners of every cell in the row, which is shared by the points in the same cell:
+	std::size_t count = std::min<std::size_t>(last - first, 255) + 2;
+	std::vector<float> values(count * 4);
+
+	for (std::size_t z = 0; z < dimensions[Z]; z += 1) {
+		float pz = origin[Z] + step[Z] * float(offset[Z] + z), fz = std::floor(pz);
+		std::size_t k = std::size_t(std::ptrdiff_t(fz));
+
+		for (std::size_t y = 0; y < dimensions[Y]; y += 1) {
+			float py = origin[Y] + step[Y] * float(offset[Y] + y), fy = std::floor(py);
+			std::size_t j = std::size_t(std::ptrdiff_t(fy));
+
+			// The permutation of (j + dy, k + dz) is the same for every cell in the row:
+			std::size_t hashes[4];
+			for (std::size_t dz = 0; dz < 2; dz += 1)
+				for (std::size_t dy = 0; dy < 2; dy += 1)
+					hashes[dy + dz * 2] = indices[(j + dy + indices[(k + dz) & 255]) & 255];
+
+			for (std::size_t cell = 0; cell < count; cell += 1) {
+				std::size_t i = std::size_t(first) + cell;
+
+				for (std::size_t corner = 0; corner < 4; corner += 1)
+					values[cell * 4 + corner] = table[indices[(i + hashes[corner]) & 255]];
+			}
+
+			float fractions[2] = {py - fy, pz - fz};
+			float * row = output + (z * dimensions[Y] + y) * dimensions[X];
+
+			std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+			for (; i + 8 <= dimensions[X]; i += 8)
+				noise_packed<8>(values.data(), lattice.data() + i, fractions, scale, accumulate, row + i);
+#endif
+
+			for (; i + 4 <= dimensions[X]; i += 4)
+				noise_packed<4>(values.data(), lattice.data() + i, fractions, scale, accumulate, row + i);
+
+			for (; i < dimensions[X]; i += 1)
+				noise_packed<1>(values.data(), lattice.data() + i, fractions, scale, accumulate, row + i);
+		}
+	}
+}
@@ -8,7 +8,10 @@
 //
 
 #include "PerlinNoise.hpp"
+#include "Kernels.hpp"
+#include "ThreadPool.hpp"
 
+#include <cmath>
 #include <random>
 #include <functional>
 #include "Interpolate.hpp"
@@ -36,9 +39,77 @@ namespace Euclid {
 			for (std::size_t i = 0; i < 256; ++i) _table[i] = (RealT)r01();
 		}
 
+		namespace {
+			/// The reciprocal octave and reciprocal scale of each sample which is added together by turbulence.
+			const RealT OCTAVES[6][2] = {
+				{1.0/32.0, 1.0/2.0},
+				{1.0/16.0, 1.0/4.0},
+				{1.0/8.0,  1.0/8.0},
+				{1.0/4.0,  1.0/16.0},
+				{1.0/2.0,  (1.0/16.0) * 0.75},
+				{1.0/1.0,  (1.0/16.0) * 0.25},
+			};
+
+			/// Bands along the x axis, which are distorted by the turbulence, scaled to the range [0, 1].
+			inline RealT marble_of(RealT strength, RealT x, RealT turbulence) {
+				return (1 + std::sin(x + strength * turbulence)) / 2;
+			}
+
+#ifdef EUCLID_NUMERICS_KERNELS
+			void sample_noise_grid(const RealT * table, const unsigned char * indices, const Vec3 & origin, const Vec3 & step, const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & dimensions, RealT scale, bool accumulate, RealT * output) {
+				EUCLID_NUMERICS_KERNELS_CALL(sample_noise_grid(table, indices, origin, step, offset, dimensions, scale, accumulate, output))
+			}
+#endif
+
+			/// Split the grid into tiles of at most TILE_SIZE points, and call function(offset, dimensions, output) for each tile on up to the given number of threads. Each tile is evaluated into a buffer and copied into the grid, so the result doesn't depend on which thread evaluates it.
+			template <typename FunctionT>
+			void evaluate_tiled(const Vector<3, std::size_t> & dimensions, RealT * output, std::size_t threads, FunctionT function) {
+				const std::size_t TILE_SIZE = PerlinNoise::TILE_SIZE;
+
+				// Tiles are as wide as possible, since the kernels evaluate the points of each row together:
+				Vector<3, std::size_t> tile;
+				tile[X] = std::min<std::size_t>(dimensions[X], 256);
+				tile[Y] = std::min<std::size_t>(dimensions[Y], std::max<std::size_t>(TILE_SIZE / std::max<std::size_t>(tile[X], 1), 1));
+				tile[Z] = std::min<std::size_t>(dimensions[Z], std::max<std::size_t>(TILE_SIZE / std::max<std::size_t>(tile[X] * tile[Y], 1), 1));
+
+				if (tile[X] == 0 || tile[Y] == 0 || tile[Z] == 0) return;
+
+				Vector<3, std::size_t> tiles = (dimensions + tile - 1) / tile;
+				std::size_t count = tiles[X] * tiles[Y] * tiles[Z];
+
+				// Tiles are taken in order by whichever thread is free, which balances the work when some threads are slower:
+				parallel_for(count, threads, [&](std::size_t index) {
+					// Each thread keeps its own buffer, which is reused for every tile it evaluates:
+					thread_local std::vector<RealT> buffer;
+					buffer.resize(tile[X] * tile[Y] * tile[Z]);
+
+					Vector<3, std::size_t> offset(index % tiles[X], (index / tiles[X]) % tiles[Y], index / (tiles[X] * tiles[Y]));
+					offset = offset * tile;
+
+					Vector<3, std::size_t> size = (offset + tile).constrain(dimensions, false) - offset;
+
+					function(offset, size, buffer.data());
+
+					const RealT * source = buffer.data();
+
+					for (std::size_t z = 0; z < size[Z]; ++z) {
+						for (std::size_t y = 0; y < size[Y]; ++y) {
+							RealT * row = output + ((offset[Z] + z) * dimensions[Y] + offset[Y] + y) * dimensions[X] + offset[X];
+
+							std::copy(source, source + size[X], row);
+							source += size[X];
+						}
+					}
+				});
+			}
+		}
+
 		RealT PerlinNoise::sample(const Vec3 &v) const {
-			Vec3 t = v.fraction();
-			Vector<3, std::size_t> o = v.truncate();
+			Vec3 f = v.truncate();
+			Vec3 t = v - f;
+
+			// Negative coordinates wrap around the permutation table:
+			Vector<3, std::ptrdiff_t> o = f;
 
 			RealT d[8];
 
@@ -76,24 +147,84 @@ namespace Euclid {
 		/* Noise should scale between 0.0...1,0 */
 		RealT PerlinNoise::turbulence (const Vec3 &at) const {
 			RealT v = 0;
-			v += sample(at, 1.0/32.0, 1.0/2.0);
-			v += sample(at, 1.0/16.0, 1.0/4.0);
-			v += sample(at, 1.0/8.0,  1.0/8.0);
-			v += sample(at, 1.0/4.0,  1.0/16.0);
-			v += sample(at, 1.0/2.0,  (1.0/16.0) * 0.75);
-			v += sample(at, 1.0/1.0,  (1.0/16.0) * 0.25);
+
+			for (auto & octave : OCTAVES)
+				v += sample(at, octave[0], octave[1]);
 
 			return v;
 		}
 
+		void PerlinNoise::sample_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT scale, bool accumulate, RealT * output) const {
+#ifdef EUCLID_NUMERICS_KERNELS
+			sample_noise_grid(_table, _indicies, origin, step, offset, dimensions, scale, accumulate, output);
+#else
+			for (std::size_t z = 0; z < dimensions[Z]; ++z)
+				for (std::size_t y = 0; y < dimensions[Y]; ++y)
+					for (std::size_t x = 0; x < dimensions[X]; ++x, ++output) {
+						RealT value = sample(origin + step * Vec3(offset + Vector<3, std::size_t>(x, y, z))) * scale;
+
+						*output = accumulate ? *output + value : value;
+					}
+#endif
+		}
+
+		void PerlinNoise::turbulence_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT * output) const {
+			// The octaves are powers of two, so scaling the grid is exact, and each octave is accumulated in the same order as turbulence:
+			for (std::size_t i = 0; i < 6; ++i) {
+				RealT roct = OCTAVES[i][0], rscale = OCTAVES[i][1];
+
+				sample_grid(origin * roct, step * roct, offset, dimensions, rscale, i > 0, output);
+			}
+		}
+
+		void PerlinNoise::marble_grid (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT * output) const {
+			turbulence_grid(origin, step, offset, dimensions, output);
+
+			for (std::size_t z = 0; z < dimensions[Z]; ++z)
+				for (std::size_t y = 0; y < dimensions[Y]; ++y)
+					for (std::size_t x = 0; x < dimensions[X]; ++x, ++output) {
+						RealT at = origin[X] + step[X] * RealT(offset[X] + x);
+
+						*output = marble_of(strength, at, *output);
+					}
+		}
+
+		void PerlinNoise::sample_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const {
+			sample_grid(origin, step, ZERO, dimensions, 1, false, output);
+		}
+
+		void PerlinNoise::turbulence_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const {
+			turbulence_grid(origin, step, ZERO, dimensions, output);
+		}
+
+		void PerlinNoise::marble_grid (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const {
+			marble_grid(strength, origin, step, ZERO, dimensions, output);
+		}
+
+		void PerlinNoise::sample_tiled (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads) const {
+			evaluate_tiled(dimensions, output, threads, [&](const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & size, RealT * tile) {
+				sample_grid(origin, step, offset, size, 1, false, tile);
+			});
+		}
+
+		void PerlinNoise::turbulence_tiled (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads) const {
+			evaluate_tiled(dimensions, output, threads, [&](const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & size, RealT * tile) {
+				turbulence_grid(origin, step, offset, size, tile);
+			});
+		}
+
+		void PerlinNoise::marble_tiled (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads) const {
+			evaluate_tiled(dimensions, output, threads, [&](const Vector<3, std::size_t> & offset, const Vector<3, std::size_t> & size, RealT * tile) {
+				marble_grid(strength, origin, step, offset, size, tile);
+			});
+		}
+
 		//RealT PerlinNoise::clouds (const Vec3 &v) const {
 		//	return (noise(v) * noise(v*.5) * noise(v*.25) * noise(v*.5*.25));
 		//}
 
 		RealT PerlinNoise::marble (const RealT &strength, const Vec3 &v) const {
-			RealT t = turbulence(v);
-
-			return t;
+			return marble_of(strength, v[X], turbulence(v));
 		}
 	}
 }
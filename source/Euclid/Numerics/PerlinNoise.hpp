@@ -28,14 +28,41 @@ namespace Euclid {
 			RealT sample (const Vec3 &v) const;
 
 			RealT turbulence (const Vec3 &v) const;
+			/// Marble-like bands along the x axis, in the range [0, 1], which are distorted by strength times the turbulence.
 			RealT marble (const RealT &strength, const Vec3 &v) const;
 
+			/// Sample the grid of points origin + step * (x, y, z) for each x < dimensions[X], y < dimensions[Y] and z < dimensions[Z], writing them to output with x varying fastest, then y, then z. This is the same as calling sample for each point, but evaluates several points at once. A 2D grid has dimensions[Z] = 1.
+			void sample_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const;
+
+			/// The same as calling turbulence for each point of the grid, see sample_grid.
+			void turbulence_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const;
+
+			/// The same as calling marble for each point of the grid, see sample_grid.
+			void marble_grid (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output) const;
+
+			/// The number of points in each tile evaluated by the tiled functions, which is small enough to stay in the cache while the octaves are added together.
+			static constexpr std::size_t TILE_SIZE = 4096;
+
+			/// Evaluate a large grid, see sample_grid, by splitting it into tiles which are evaluated concurrently on up to the given number of threads of the shared ThreadPool, or all of them if zero. The output is identical to sample_grid, regardless of the number of threads.
+			void sample_tiled (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads = 0) const;
+
+			/// Evaluate turbulence_grid in tiles, see sample_tiled.
+			void turbulence_tiled (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads = 0) const;
+
+			/// Evaluate marble_grid in tiles, see sample_tiled.
+			void marble_tiled (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &dimensions, RealT * output, std::size_t threads = 0) const;
+
 			/* roct -> reciprocal octave, ie 1/oct, rscale is 1/scale */
 			RealT sample(const Vec3 &at, RealT roct, RealT rscale) const {
 				return sample(at * roct) * rscale;
 			}
 
 		protected:
+			/// Sample the part of a grid which starts at the given offset, multiplying by scale and adding to the output if accumulate is true. The points are the same as those of the whole grid, so tiles of the grid can be evaluated independently.
+			void sample_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT scale, bool accumulate, RealT * output) const;
+			void turbulence_grid (const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT * output) const;
+			void marble_grid (const RealT &strength, const Vec3 &origin, const Vec3 &step, const Vector<3, std::size_t> &offset, const Vector<3, std::size_t> &dimensions, RealT * output) const;
+
 			RealT lattice_noise(std::size_t i, std::size_t j, std::size_t k) const;
 			RealT spline (RealT x) const;
 		};
@@ -0,0 +1,163 @@
+//
+//  Numerics/QuantileSketch.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_QUANTILE_SKETCH_H
+#define _EUCLID_NUMERICS_QUANTILE_SKETCH_H
+
+#include "Numerics.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// Estimates the quantiles of a stream of samples, e.g. the 99th percentile of a latency, without keeping the samples. The samples are counted in a histogram with logarithmically spaced buckets, like an HDR histogram, so each quantile is estimated with a relative error of at most 1 / (2 * SUBDIVISIONS), i.e. 0.8%. Adding a sample is O(1), and the memory is bounded by the number of buckets between the smallest and largest magnitudes added.
+		class QuantileSketch
+		{
+		public:
+			/// The number of buckets for each power of two.
+			static constexpr std::size_t SUBDIVISIONS = 64;
+
+			/// Magnitudes below 2^MINIMUM_EXPONENT are counted as zero, and magnitudes above 2^MAXIMUM_EXPONENT are counted in the last bucket, which bounds the number of buckets.
+			static constexpr int MINIMUM_EXPONENT = -64, MAXIMUM_EXPONENT = 64;
+
+		protected:
+			/// The counts of the buckets with indices [_first, _first + _counts.size()), which only covers the buckets that have been used.
+			std::ptrdiff_t _first = 0;
+			std::vector<std::uint64_t> _counts;
+			std::uint64_t _total = 0;
+
+			/// The index of the bucket containing a value, which is monotonic in the value: zero for zero, and negative for negative values. NaN isn't in any bucket.
+			static std::ptrdiff_t index_of (double value)
+			{
+				assert(!std::isnan(value));
+
+				double magnitude = std::abs(value);
+
+				int exponent;
+				double mantissa = std::frexp(magnitude, &exponent);
+
+				// The magnitude is mantissa * 2^exponent, where mantissa is in [0.5, 1):
+				if (magnitude == 0 || exponent <= MINIMUM_EXPONENT)
+					return 0;
+
+				std::ptrdiff_t index;
+
+				if (exponent > MAXIMUM_EXPONENT || std::isinf(magnitude))
+					index = (MAXIMUM_EXPONENT - MINIMUM_EXPONENT) * SUBDIVISIONS;
+				else
+					index = 1 + (exponent - 1 - MINIMUM_EXPONENT) * SUBDIVISIONS + std::ptrdiff_t((mantissa * 2 - 1) * SUBDIVISIONS);
+
+				return value < 0 ? -index : index;
+			}
+
+			/// The value in the middle of a bucket, which is the estimate of every sample in it.
+			static double value_of (std::ptrdiff_t index)
+			{
+				if (index == 0) return 0;
+
+				std::size_t offset = std::abs(index) - 1;
+				int exponent = int(offset / SUBDIVISIONS) + 1 + MINIMUM_EXPONENT;
+				double subdivision = double(offset % SUBDIVISIONS) + 0.5;
+
+				double magnitude = std::ldexp(0.5 * (1 + subdivision / SUBDIVISIONS), exponent);
+
+				return index < 0 ? -magnitude : magnitude;
+			}
+
+			/// Ensure the counts include the given bucket, and return its count.
+			std::uint64_t & count_at (std::ptrdiff_t index)
+			{
+				if (_counts.empty()) {
+					_first = index;
+					_counts.resize(1);
+				} else if (index < _first) {
+					_counts.insert(_counts.begin(), std::size_t(_first - index), 0);
+					_first = index;
+				} else if (index >= _first + std::ptrdiff_t(_counts.size())) {
+					_counts.resize(std::size_t(index - _first) + 1);
+				}
+
+				return _counts[std::size_t(index - _first)];
+			}
+
+		public:
+			/// Count a sample. NaN is ignored, since it has no rank.
+			void add_sample (double value)
+			{
+				if (std::isnan(value)) return;
+
+				count_at(index_of(value)) += 1;
+				_total += 1;
+			}
+
+			/// Add the samples from another sketch, which is exact: the result is the same as if every sample had been added to this sketch.
+			void add_samples (const QuantileSketch & other)
+			{
+				if (other._counts.empty()) return;
+
+				std::ptrdiff_t first = other._first, last = other._first + std::ptrdiff_t(other._counts.size()) - 1;
+
+				// Grow the counts to cover both ends of the other sketch first, so they are resized at most twice:
+				count_at(first);
+				count_at(last);
+
+				for (std::size_t i = 0; i < other._counts.size(); i += 1)
+					_counts[std::size_t(first - _first) + i] += other._counts[i];
+
+				_total += other._total;
+			}
+
+			/// Remove all the samples, but keep the buckets, so that adding similar samples again doesn't allocate.
+			void clear ()
+			{
+				std::fill(_counts.begin(), _counts.end(), 0);
+				_total = 0;
+			}
+
+			/// The number of samples added.
+			std::uint64_t number_of_samples () const
+			{
+				return _total;
+			}
+
+			/// The number of buckets which are allocated, which is bounded regardless of the number of samples.
+			std::size_t number_of_buckets () const
+			{
+				return _counts.size();
+			}
+
+			/// Estimate the value below which the given fraction of the samples lie, e.g. 0.5 for the median or 0.99 for the 99th percentile, using the nearest rank. Returns zero if there are no samples.
+			double quantile (double fraction) const
+			{
+				if (_total == 0) return 0;
+
+				fraction = std::min(std::max(fraction, 0.0), 1.0);
+
+				// The rank of the sample, from zero:
+				std::uint64_t rank = std::uint64_t(std::ceil(fraction * _total));
+				if (rank > 0) rank -= 1;
+
+				std::uint64_t cumulative = 0;
+
+				for (std::size_t i = 0; i < _counts.size(); i += 1) {
+					cumulative += _counts[i];
+
+					if (cumulative > rank)
+						return value_of(_first + std::ptrdiff_t(i));
+				}
+
+				return value_of(_first + std::ptrdiff_t(_counts.size()) - 1);
+			}
+		};
+	}
+}
+
+#endif
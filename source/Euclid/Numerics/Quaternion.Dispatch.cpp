@@ -0,0 +1,44 @@
+//
+//  Numerics/Quaternion.Dispatch.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Quaternion.Dispatch.hpp"
+#include "Quaternion.Interpolate.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		Quaternion<float> multiply(const Quaternion<float> & q1, const Quaternion<float> & q2) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(q1, q2))
+		}
+
+		Quaternion<double> multiply(const Quaternion<double> & q1, const Quaternion<double> & q2) {
+			EUCLID_NUMERICS_KERNELS_CALL(multiply(q1, q2))
+		}
+
+		void rotate_vectors(const Quaternion<float> & rotation, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(rotate_vectors(rotation, input, output, count))
+		}
+
+		void compose_quaternions(const Quaternion<float> * left, const Quaternion<float> * right, Quaternion<float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(compose_quaternions(left, right, output, count))
+		}
+
+		void compose_quaternions(const Quaternion<double> * left, const Quaternion<double> * right, Quaternion<double> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(compose_quaternions(left, right, output, count))
+		}
+
+		void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, const float * factors, Quaternion<float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(interpolate_quaternions(mode, from, to, factors, output, count))
+		}
+
+		void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, float factor, Quaternion<float> * output, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(interpolate_quaternions(mode, from, to, factor, output, count))
+		}
+	}
+}
+
+#endif
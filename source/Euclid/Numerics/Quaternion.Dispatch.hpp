@@ -0,0 +1,29 @@
+//
+//  Numerics/Quaternion.Dispatch.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_QUATERNION_DISPATCH_H
+#define _EUCLID_NUMERICS_QUATERNION_DISPATCH_H
+
+#include "Quaternion.hpp"
+#include "Instructions.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		Quaternion<float> multiply(const Quaternion<float> & q1, const Quaternion<float> & q2);
+		Quaternion<double> multiply(const Quaternion<double> & q1, const Quaternion<double> & q2);
+
+		void rotate_vectors(const Quaternion<float> & rotation, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count);
+
+		void compose_quaternions(const Quaternion<float> * left, const Quaternion<float> * right, Quaternion<float> * output, std::size_t count);
+		void compose_quaternions(const Quaternion<double> * left, const Quaternion<double> * right, Quaternion<double> * output, std::size_t count);
+	}
+}
+
+#endif
+
+#endif
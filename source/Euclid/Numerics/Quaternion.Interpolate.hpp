@@ -10,37 +10,138 @@
 #define _EUCLID_NUMERICS_QUATERNION_INTERPOLATE_H
 
 #include "Quaternion.hpp"
+#include "Instructions.hpp"
+
+#include <cmath>
+#include <cstddef>
 
 namespace Euclid {
 	namespace Numerics {
+		/// The methods which can be used to interpolate arrays of quaternions.
+		enum class QuaternionInterpolation {
+			/// Exact spherical linear interpolation, see spherical_linear_interpolate.
+			SPHERICAL,
+			/// Normalized linear interpolation, see normalized_linear_interpolate.
+			NORMALIZED,
+			/// Polynomial approximation of spherical linear interpolation, see fast_spherical_linear_interpolate.
+			FAST_SPHERICAL,
+		};
 
-		/// Spherical linear interpolation is typically used to interpolate between rotations represented in quaternion space.
+		/// Compute the weights a and b of q0 and q1 for spherical linear interpolation, given the cosine of the angle between them, which must not be negative. The weighted sum must be normalized, since it falls back to linear interpolation when the angle is very small.
 		template <typename NumericT>
-		Vector<4, NumericT> spherical_linear_interpolate (NumericT t, const Vector<4, NumericT> & q0, const Vector<4, NumericT> & q1)
+		void spherical_linear_weights (NumericT t, NumericT dot, NumericT & a, NumericT & b)
 		{
-			// Compute the cosine of the angle between the two vectors.
-			auto dot = q0.dot(q1);
-
 			const NumericT DOT_THRESHOLD = 0.9995;
 			if (dot > DOT_THRESHOLD) {
-				// If the inputs are too close for comfort, linearly interpolate
-				// and normalize the result.
-				return (q0 + (q1 - q0) * t).normalize()
+				// If the inputs are too close for comfort, linearly interpolate:
+				a = 1 - t;
+				b = t;
+
+				return;
 			}
 
-			// theta_0 = angle between input vectors:
-			auto theta_0 = dot.acos();
+			// theta = angle between the inputs:
+			NumericT theta = std::acos(dot), sin_theta = std::sin(theta);
+
+			a = std::sin((1 - t) * theta) / sin_theta;
+			b = std::sin(t * theta) / sin_theta;
+		}
+
+		/// The coefficients of the polynomial used by fast_spherical_linear_weight, u[i] = 1 / (i * (2i + 1)) and v[i] = i / (2i + 1), where the last term is scaled by mu to correct for the truncated series. See "A Fast and Accurate Algorithm for Computing SLERP" by David Eberly.
+		template <typename NumericT>
+		struct FastSphericalCoefficients {
+			static constexpr std::size_t COUNT = 8;
+			static constexpr double MU = 1.85298109240830;
 
-			// theta = angle between v0 and result:
-			auto theta = theta_0 * t;
+			static constexpr NumericT U[COUNT] = {1.0/3, 1.0/10, 1.0/21, 1.0/36, 1.0/55, 1.0/78, 1.0/105, MU/136};
+			static constexpr NumericT V[COUNT] = {1.0/3, 2.0/5, 3.0/7, 4.0/9, 5.0/11, 6.0/13, 7.0/15, MU*8/17};
+		};
 
-			auto v2 = (v1 - v0 * dot).normalize();
+		/// Approximate sin(t * theta) / sin(theta), where cos(theta) = dot, using a polynomial in (dot - 1). For t and dot in [0, 1], the absolute error is less than 2e-5.
+		template <typename NumericT>
+		NumericT fast_spherical_linear_weight (NumericT t, NumericT dot)
+		{
+			typedef FastSphericalCoefficients<NumericT> CoefficientsT;
 
-			// { v0, v2 } is now an orthonormal basis.
-			return Quaternion(v0*cos(theta) + v2*sin(theta));
+			NumericT x = dot - 1, t2 = t * t, c = 1;
+
+			for (std::size_t i = CoefficientsT::COUNT; i-- > 0;)
+				c = (CoefficientsT::U[i] * t2 - CoefficientsT::V[i]) * x * c + 1;
+
+			return t * c;
+		}
+
+		/// Spherical linear interpolation is typically used to interpolate between rotations represented in quaternion space. It follows the shortest path, since q and -q represent the same rotation.
+		template <typename NumericT>
+		Vector<4, NumericT> spherical_linear_interpolate (NumericT t, const Vector<4, NumericT> & q0, const Vector<4, NumericT> & q1)
+		{
+			// Compute the cosine of the angle between the two vectors.
+			NumericT dot = q0.dot(q1), sign = dot < 0 ? -1 : 1;
+
+			NumericT a, b;
+			spherical_linear_weights<NumericT>(t, dot * sign, a, b);
+
+			return (q0 * a + q1 * (b * sign)).normalize();
+		}
+
+		/// Normalized linear interpolation follows the same path as spherical linear interpolation, but not at a constant angular velocity. It is the cheapest method, and is often good enough for blending animations.
+		template <typename NumericT>
+		Vector<4, NumericT> normalized_linear_interpolate (NumericT t, const Vector<4, NumericT> & q0, const Vector<4, NumericT> & q1)
+		{
+			NumericT dot = q0.dot(q1), sign = dot < 0 ? -1 : 1;
+
+			return (q0 * (1 - t) + q1 * (t * sign)).normalize();
+		}
+
+		/// Approximate spherical linear interpolation without any trigonometric functions. The result is within about 4e-5 of spherical_linear_interpolate, and is not normalized.
+		template <typename NumericT>
+		Vector<4, NumericT> fast_spherical_linear_interpolate (NumericT t, const Vector<4, NumericT> & q0, const Vector<4, NumericT> & q1)
+		{
+			NumericT dot = q0.dot(q1), sign = dot < 0 ? -1 : 1;
+
+			dot *= sign;
+
+			return q0 * fast_spherical_linear_weight<NumericT>(1 - t, dot) + q1 * (fast_spherical_linear_weight<NumericT>(t, dot) * sign);
+		}
+
+		template <typename NumericT>
+		Quaternion<NumericT> interpolate (QuaternionInterpolation mode, NumericT t, const Quaternion<NumericT> & q0, const Quaternion<NumericT> & q1)
+		{
+			switch (mode) {
+				case QuaternionInterpolation::NORMALIZED: return normalized_linear_interpolate(t, q0, q1);
+				case QuaternionInterpolation::FAST_SPHERICAL: return fast_spherical_linear_interpolate(t, q0, q1);
+				default: return spherical_linear_interpolate(t, q0, q1);
+			}
+		}
+
+		/// Interpolate two arrays of quaternions pairwise, i.e. output[i] = interpolate(mode, factors[i], from[i], to[i]). The output may be the same array as either input.
+		template <typename NumericT>
+		void interpolate_quaternions (QuaternionInterpolation mode, const Quaternion<NumericT> * from, const Quaternion<NumericT> * to, const NumericT * factors, Quaternion<NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				output[i] = interpolate(mode, factors[i], from[i], to[i]);
+		}
+
+		/// Interpolate two arrays of quaternions pairwise using the same factor, e.g. to blend two animation poses.
+		template <typename NumericT>
+		void interpolate_quaternions (QuaternionInterpolation mode, const Quaternion<NumericT> * from, const Quaternion<NumericT> * to, NumericT factor, Quaternion<NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				output[i] = interpolate(mode, factor, from[i], to[i]);
 		}
-		
 	}
 }
 
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, const float * factors, Quaternion<float> * output, std::size_t count);
+		void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, float factor, Quaternion<float> * output, std::size_t count);
+	}
+}
+
+#endif
+
 #endif
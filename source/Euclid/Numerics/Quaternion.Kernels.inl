@@ -0,0 +1,230 @@
+//
+//  Numerics/Quaternion.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The quaternion multiplication, rotation and interpolation kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set.
+
+namespace {
+	static_assert(sizeof(Quaternion<float>) == sizeof(float) * 4, "Quaternion<float> must be tightly packed!");
+	static_assert(sizeof(Quaternion<double>) == sizeof(double) * 4, "Quaternion<double> must be tightly packed!");
+
+	/// The Hamilton product of WIDTH / 4 quaternions packed in a and b, expanded as a linear combination of permutations of b:
+	///		a * b = w1 * (x2, y2, z2, w2) + x1 * (w2, -z2, y2, -x2) + y1 * (z2, w2, -x2, -y2) + z1 * (-y2, x2, w2, -z2)
+	/// The inputs are loaded before the result is stored, so r may alias a or b.
+	template <typename NumericT, std::size_t WIDTH>
+	inline void multiply_packed (NumericT * r, const NumericT * a, const NumericT * b)
+	{
+		typedef Packet<NumericT, WIDTH> PacketT;
+
+		// The signs are repeated so that they can be loaded for two quaternions at a time:
+		static const NumericT x_signs[8] = {1, -1, 1, -1, 1, -1, 1, -1};
+		static const NumericT y_signs[8] = {1, 1, -1, -1, 1, 1, -1, -1};
+		static const NumericT z_signs[8] = {-1, 1, 1, -1, -1, 1, 1, -1};
+
+		PacketT q1 = PacketT::load(a), q2 = PacketT::load(b);
+
+		PacketT result = q1.template swizzle<3, 3, 3, 3>() * q2;
+		result = multiply_add(q1.template swizzle<0, 0, 0, 0>() * PacketT::load(x_signs), q2.template swizzle<3, 2, 1, 0>(), result);
+		result = multiply_add(q1.template swizzle<1, 1, 1, 1>() * PacketT::load(y_signs), q2.template swizzle<2, 3, 0, 1>(), result);
+		result = multiply_add(q1.template swizzle<2, 2, 2, 2>() * PacketT::load(z_signs), q2.template swizzle<1, 0, 3, 2>(), result);
+
+		result.store(r);
+	}
+
+	template <typename NumericT>
+	void compose_batch (const Quaternion<NumericT> * left, const Quaternion<NumericT> * right, Quaternion<NumericT> * output, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		// Single precision quaternions are composed two per pass, the first in the low half of the registers and the second in the high half:
+		constexpr std::size_t WIDE = 32 / sizeof(NumericT);
+
+		for (; i + WIDE / 4 <= count; i += WIDE / 4)
+			multiply_packed<NumericT, WIDE>(output[i].data(), left[i].data(), right[i].data());
+#endif
+
+		for (; i < count; i += 1)
+			multiply_packed<NumericT, 4>(output[i].data(), left[i].data(), right[i].data());
+	}
+
+	/// Rotate the vectors (x, y, z) by the unit quaternions (ux, uy, uz, w), using the cross product form:
+	///		t = 2 * (u x v), v' = v + w * t + u x t
+	template <typename PacketT>
+	inline void rotate_components (const PacketT & ux, const PacketT & uy, const PacketT & uz, const PacketT & w, PacketT & x, PacketT & y, PacketT & z)
+	{
+		PacketT two = PacketT::broadcast(2);
+
+		PacketT tx = (uy * z - uz * y) * two;
+		PacketT ty = (uz * x - ux * z) * two;
+		PacketT tz = (ux * y - uy * x) * two;
+
+		x = multiply_add(w, tx, x) + (uy * tz - uz * ty);
+		y = multiply_add(w, ty, y) + (uz * tx - ux * tz);
+		z = multiply_add(w, tz, z) + (ux * ty - uy * tx);
+	}
+
+	/// Rotate WIDTH packed vectors by the unit quaternion q. The input is loaded before the output is stored, so they may alias.
+	template <std::size_t WIDTH>
+	inline void rotate_packed (const Quaternion<float> & q, const float * input, float * output)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		PacketT x, y, z;
+		load_vectors(input, x, y, z);
+
+		rotate_components(PacketT::broadcast(q[X]), PacketT::broadcast(q[Y]), PacketT::broadcast(q[Z]), PacketT::broadcast(q[W]), x, y, z);
+
+		store_vectors(output, x, y, z);
+	}
+
+	/// The packet equivalent of fast_spherical_linear_weight.
+	template <typename NumericT, std::size_t WIDTH>
+	inline Packet<NumericT, WIDTH> fast_spherical_weight (const Packet<NumericT, WIDTH> & t, const Packet<NumericT, WIDTH> & dot)
+	{
+		typedef Packet<NumericT, WIDTH> PacketT;
+		typedef FastSphericalCoefficients<NumericT> CoefficientsT;
+
+		PacketT one = PacketT::broadcast(1);
+		PacketT x = dot - one, t2 = t * t, c = one;
+
+		for (std::size_t i = CoefficientsT::COUNT; i-- > 0;)
+			c = multiply_add((PacketT::broadcast(CoefficientsT::U[i]) * t2 - PacketT::broadcast(CoefficientsT::V[i])) * x, c, one);
+
+		return t * c;
+	}
+
+	/// Interpolate WIDTH pairs of quaternions, each of which is transposed into the lanes of the x, y, z and w packets. The inputs are loaded before the output is stored, so they may alias.
+	template <QuaternionInterpolation MODE, std::size_t WIDTH>
+	inline void interpolate_packed (const float * from, const float * to, const Packet<float, WIDTH> & t, float * output)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+
+		PacketT x0, y0, z0, w0, x1, y1, z1, w1;
+		load_quaternions(from, x0, y0, z0, w0);
+		load_quaternions(to, x1, y1, z1, w1);
+
+		PacketT one = PacketT::broadcast(1), zero = PacketT::broadcast(0);
+
+		// Interpolate along the shortest path, since q and -q represent the same rotation:
+		PacketT dot = multiply_add(w0, w1, multiply_add(z0, z1, multiply_add(y0, y1, x0 * x1)));
+		PacketT sign = zero.select_greater(dot, PacketT::broadcast(-1), one);
+		dot = dot * sign;
+
+		PacketT a, b;
+
+		if (MODE == QuaternionInterpolation::SPHERICAL) {
+			// The trigonometric functions are evaluated one lane at a time:
+			float dots[WIDTH], factors[WIDTH], a_weights[WIDTH], b_weights[WIDTH];
+			dot.store(dots);
+			t.store(factors);
+
+			for (std::size_t i = 0; i < WIDTH; i += 1)
+				Numerics::spherical_linear_weights(factors[i], dots[i], a_weights[i], b_weights[i]);
+
+			a = PacketT::load(a_weights);
+			b = PacketT::load(b_weights);
+		} else if (MODE == QuaternionInterpolation::FAST_SPHERICAL) {
+			a = fast_spherical_weight(one - t, dot);
+			b = fast_spherical_weight(t, dot);
+		} else {
+			a = one - t;
+			b = t;
+		}
+
+		b = b * sign;
+
+		PacketT x = multiply_add(x0, a, x1 * b), y = multiply_add(y0, a, y1 * b), z = multiply_add(z0, a, z1 * b), w = multiply_add(w0, a, w1 * b);
+
+		if (MODE != QuaternionInterpolation::FAST_SPHERICAL) {
+			PacketT factor = one / multiply_add(w, w, multiply_add(z, z, multiply_add(y, y, x * x))).square_root();
+
+			x = x * factor; y = y * factor; z = z * factor; w = w * factor;
+		}
+
+		store_quaternions(output, x, y, z, w);
+	}
+
+	template <typename PacketT>
+	inline PacketT load_factors (const float * factors, std::size_t i) {
+		return PacketT::load(factors + i);
+	}
+
+	template <typename PacketT>
+	inline PacketT load_factors (float factor, std::size_t) {
+		return PacketT::broadcast(factor);
+	}
+
+	template <QuaternionInterpolation MODE, typename FactorsT>
+	void interpolate_batch (const Quaternion<float> * from, const Quaternion<float> * to, FactorsT factors, Quaternion<float> * output, std::size_t count)
+	{
+		std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		for (; i + 8 <= count; i += 8)
+			interpolate_packed<MODE, 8>(from[i].data(), to[i].data(), load_factors<Packet<float, 8>>(factors, i), output[i].data());
+#endif
+
+		for (; i + 4 <= count; i += 4)
+			interpolate_packed<MODE, 4>(from[i].data(), to[i].data(), load_factors<Packet<float, 4>>(factors, i), output[i].data());
+
+		for (; i < count; i += 1)
+			interpolate_packed<MODE, 1>(from[i].data(), to[i].data(), load_factors<Packet<float, 1>>(factors, i), output[i].data());
+	}
+
+	template <typename FactorsT>
+	void interpolate_batch (QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, FactorsT factors, Quaternion<float> * output, std::size_t count)
+	{
+		switch (mode) {
+			case QuaternionInterpolation::NORMALIZED: return interpolate_batch<QuaternionInterpolation::NORMALIZED>(from, to, factors, output, count);
+			case QuaternionInterpolation::FAST_SPHERICAL: return interpolate_batch<QuaternionInterpolation::FAST_SPHERICAL>(from, to, factors, output, count);
+			default: return interpolate_batch<QuaternionInterpolation::SPHERICAL>(from, to, factors, output, count);
+		}
+	}
+}
+
+Quaternion<float> multiply(const Quaternion<float> & q1, const Quaternion<float> & q2) {
+	Quaternion<float> result;
+	multiply_packed<float, 4>(result.data(), q1.data(), q2.data());
+
+	return result;
+}
+
+Quaternion<double> multiply(const Quaternion<double> & q1, const Quaternion<double> & q2) {
+	Quaternion<double> result;
+	multiply_packed<double, 4>(result.data(), q1.data(), q2.data());
+
+	return result;
+}
+
+void rotate_vectors(const Quaternion<float> & rotation, const Vector<3, float> * input, Vector<3, float> * output, std::size_t count) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		rotate_packed<8>(rotation, input[i].data(), output[i].data());
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		rotate_packed<4>(rotation, input[i].data(), output[i].data());
+
+	for (; i < count; i += 1)
+		rotate_packed<1>(rotation, input[i].data(), output[i].data());
+}
+
+void compose_quaternions(const Quaternion<float> * left, const Quaternion<float> * right, Quaternion<float> * output, std::size_t count) {
+	compose_batch(left, right, output, count);
+}
+
+void compose_quaternions(const Quaternion<double> * left, const Quaternion<double> * right, Quaternion<double> * output, std::size_t count) {
+	compose_batch(left, right, output, count);
+}
+
+void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, const float * factors, Quaternion<float> * output, std::size_t count) {
+	interpolate_batch(mode, from, to, factors, output, count);
+}
+
+void interpolate_quaternions(QuaternionInterpolation mode, const Quaternion<float> * from, const Quaternion<float> * to, float factor, Quaternion<float> * output, std::size_t count) {
+	interpolate_batch(mode, from, to, factor, output, count);
+}
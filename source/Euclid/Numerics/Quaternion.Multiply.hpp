@@ -27,6 +27,40 @@ namespace Euclid {
 			return result;
 		}
 
+		/// Rotate a vector by a unit quaternion using the cross product form, which is cheaper than building a rotation matrix:
+		///		t = 2 * (u x v), v' = v + w * t + u x t
+		/// where u is the vector part of the quaternion and w is the scalar part.
+		template <typename NumericT>
+		Vector<3, NumericT> rotate (const Quaternion<NumericT> & rotation, const Vector<3, NumericT> & v)
+		{
+			auto u = rotation.reduce();
+			auto t = cross_product(u, v) * NumericT(2);
+
+			return v + t * rotation[W] + cross_product(u, t);
+		}
+
+		/// Rotate an array of vectors by the same unit quaternion. The output may be the same array as the input.
+		template <typename NumericT>
+		void rotate_vectors (const Quaternion<NumericT> & rotation, const Vector<3, NumericT> * input, Vector<3, NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				output[i] = rotate(rotation, input[i]);
+		}
+
+		/// Compose two arrays of quaternions pairwise, i.e. output[i] = left[i] * right[i]. The output may be the same array as either input.
+		template <typename NumericT>
+		void compose_quaternions (const Quaternion<NumericT> * left, const Quaternion<NumericT> * right, Quaternion<NumericT> * output, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				output[i] = multiply<NumericT>(left[i], right[i]);
+		}
+	}
+}
+
+#include "Quaternion.Dispatch.hpp"
+
+namespace Euclid {
+	namespace Numerics {
 		template <typename NumericT>
 		Quaternion<NumericT> operator* (const Quaternion<NumericT> & q1, const Quaternion<NumericT> & q2) {
 			return multiply(q1, q2);
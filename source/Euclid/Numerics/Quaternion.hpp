@@ -85,17 +85,9 @@ namespace Euclid
 				return copy;
 			}
 
-			/// Rotate a point:
+			/// Rotate a point, see rotate in Quaternion.Multiply.hpp:
 			Vector<3, NumericT> operator* (const Vector<3, NumericT> & v) const {
-				auto qvec = this->reduce();
-
-				auto uv = cross_product(qvec, v);
-				auto uuv = cross_product(qvec, uv);
-
-				uv *= (*this)[W] * 2;
-				uuv *= 2;
-
-				return v + uv + uuv;
+				return rotate(*this, v);
 			}
 
 			template <typename RightT>
@@ -105,6 +97,13 @@ namespace Euclid
 			}
 		};
 
+		/// Consecutive quaternions are cheaper to multiply together than to compose individually.
+		template <typename ApplyT, typename NumericT>
+		Quaternion<NumericT> fold (ApplyT &, const Quaternion<NumericT> & pending, const Quaternion<NumericT> & rotation)
+		{
+			return pending * rotation;
+		}
+
 		template <typename NumericT>
 		Quaternion<NumericT> quaternion (const Vector<4, NumericT> & v) {
 			return v;
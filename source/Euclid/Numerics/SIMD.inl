@@ -0,0 +1,579 @@
+//
+//  Numerics/SIMD.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// A thin wrapper over SIMD registers, which kernels are written against so that they can be compiled for every instruction set. This file has no include guard, and is named .inl rather than .hpp so that it isn't installed with the headers, like the *.Kernels.inl files: it is included by the Kernels.*.cpp files inside the namespace of an instruction set, after the intrinsics headers, with one of the following defined:
+//
+//	EUCLID_NUMERICS_SIMD_SSE2: 128-bit registers.
+//	EUCLID_NUMERICS_SIMD_AVX2: 256-bit registers and fused multiply-add.
+//	EUCLID_NUMERICS_SIMD_NEON: 128-bit single precision registers.
+//
+// Packets which the instruction set doesn't provide, and everything when none is defined, use the scalar fallback, which is a plain array of numbers.
+
+#if defined(EUCLID_NUMERICS_SIMD_AVX2)
+#define EUCLID_NUMERICS_SIMD_SSE2
+#define EUCLID_NUMERICS_SIMD_BYTES 32
+#else
+#define EUCLID_NUMERICS_SIMD_BYTES 16
+#endif
+
+namespace {
+	/// A packet of WIDTH numbers which are processed together. The generic implementation is the scalar fallback.
+	template <typename NumericT, std::size_t WIDTH_>
+	struct Packet {
+		enum { WIDTH = WIDTH_ };
+		NumericT values[WIDTH];
+
+		static Packet load (const NumericT * p) {
+			Packet result;
+			for (std::size_t i = 0; i < WIDTH; i += 1) result.values[i] = p[i];
+			return result;
+		}
+
+		static Packet broadcast (const NumericT & v) {
+			Packet result;
+			for (std::size_t i = 0; i < WIDTH; i += 1) result.values[i] = v;
+			return result;
+		}
+
+		void store (NumericT * p) const {
+			for (std::size_t i = 0; i < WIDTH; i += 1) p[i] = values[i];
+		}
+
+		/// Load each half of the packet from a different address.
+		static Packet load_halves (const NumericT * low, const NumericT * high) {
+			Packet result;
+			for (std::size_t i = 0; i < WIDTH / 2; i += 1) {
+				result.values[i] = low[i];
+				result.values[WIDTH / 2 + i] = high[i];
+			}
+			return result;
+		}
+
+		void store_halves (NumericT * low, NumericT * high) const {
+			for (std::size_t i = 0; i < WIDTH / 2; i += 1) {
+				low[i] = values[i];
+				high[i] = values[WIDTH / 2 + i];
+			}
+		}
+
+#define EUCLID_NUMERICS_SIMD_EACH(EXPRESSION) \
+			Packet result; \
+			for (std::size_t i = 0; i < WIDTH; i += 1) result.values[i] = EXPRESSION; \
+			return result;
+
+		Packet operator+ (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(values[i] + other.values[i]) }
+		Packet operator- (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(values[i] - other.values[i]) }
+		Packet operator* (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(values[i] * other.values[i]) }
+		Packet operator/ (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(values[i] / other.values[i]) }
+
+		Packet minimum (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(std::min(values[i], other.values[i])) }
+		Packet maximum (const Packet & other) const { EUCLID_NUMERICS_SIMD_EACH(std::max(values[i], other.values[i])) }
+		Packet square_root () const { EUCLID_NUMERICS_SIMD_EACH(std::sqrt(values[i])) }
+
+		/// Select a where this > threshold, otherwise b.
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const { EUCLID_NUMERICS_SIMD_EACH(values[i] > threshold.values[i] ? a.values[i] : b.values[i]) }
+
+		/// (v[X], v[Y], v[Z], v[W]) within each group of four numbers.
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const {
+			static const int indices[4] = {X, Y, Z, W};
+			EUCLID_NUMERICS_SIMD_EACH(values[(i & ~3) + indices[i & 3]])
+		}
+
+#undef EUCLID_NUMERICS_SIMD_EACH
+	};
+
+	/// (a * b) + c, which is fused where the instruction set supports it.
+	template <typename NumericT, std::size_t WIDTH>
+	inline Packet<NumericT, WIDTH> multiply_add (const Packet<NumericT, WIDTH> & a, const Packet<NumericT, WIDTH> & b, const Packet<NumericT, WIDTH> & c) {
+		return a * b + c;
+	}
+
+	/// Load WIDTH packed 3-vectors, i.e. {x0 y0 z0 x1 y1 z1 ...}, and split their components into separate packets.
+	template <typename NumericT, std::size_t WIDTH>
+	inline void load_vectors (const NumericT * p, Packet<NumericT, WIDTH> & x, Packet<NumericT, WIDTH> & y, Packet<NumericT, WIDTH> & z) {
+		NumericT components[3][WIDTH];
+
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			for (std::size_t j = 0; j < 3; j += 1) components[j][i] = p[i*3 + j];
+
+		typedef Packet<NumericT, WIDTH> PacketT;
+		x = PacketT::load(components[0]); y = PacketT::load(components[1]); z = PacketT::load(components[2]);
+	}
+
+	/// The inverse of load_vectors.
+	template <typename NumericT, std::size_t WIDTH>
+	inline void store_vectors (NumericT * p, const Packet<NumericT, WIDTH> & x, const Packet<NumericT, WIDTH> & y, const Packet<NumericT, WIDTH> & z) {
+		NumericT components[3][WIDTH];
+		x.store(components[0]); y.store(components[1]); z.store(components[2]);
+
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			for (std::size_t j = 0; j < 3; j += 1) p[i*3 + j] = components[j][i];
+	}
+
+	/// Load WIDTH packed 4-vectors, e.g. quaternions, and split their components into separate packets.
+	template <typename NumericT, std::size_t WIDTH>
+	inline void load_quaternions (const NumericT * p, Packet<NumericT, WIDTH> & x, Packet<NumericT, WIDTH> & y, Packet<NumericT, WIDTH> & z, Packet<NumericT, WIDTH> & w) {
+		NumericT components[4][WIDTH];
+
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			for (std::size_t j = 0; j < 4; j += 1) components[j][i] = p[i*4 + j];
+
+		typedef Packet<NumericT, WIDTH> PacketT;
+		x = PacketT::load(components[0]); y = PacketT::load(components[1]); z = PacketT::load(components[2]); w = PacketT::load(components[3]);
+	}
+
+	/// The inverse of load_quaternions.
+	template <typename NumericT, std::size_t WIDTH>
+	inline void store_quaternions (NumericT * p, const Packet<NumericT, WIDTH> & x, const Packet<NumericT, WIDTH> & y, const Packet<NumericT, WIDTH> & z, const Packet<NumericT, WIDTH> & w) {
+		NumericT components[4][WIDTH];
+		x.store(components[0]); y.store(components[1]); z.store(components[2]); w.store(components[3]);
+
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			for (std::size_t j = 0; j < 4; j += 1) p[i*4 + j] = components[j][i];
+	}
+
+	/// A bit mask of the lanes in which a and b are equivalent, see Tolerance::equivalent.
+	template <typename NumericT, std::size_t WIDTH>
+	inline unsigned equivalent_mask (const Packet<NumericT, WIDTH> & a, const Packet<NumericT, WIDTH> & b, const Tolerance<NumericT> & tolerance) {
+		NumericT x[WIDTH], y[WIDTH];
+		a.store(x); b.store(y);
+
+		unsigned mask = 0;
+
+		for (std::size_t i = 0; i < WIDTH; i += 1)
+			if (tolerance.equivalent(x[i], y[i])) mask |= 1u << i;
+
+		return mask;
+	}
+
+#ifdef EUCLID_NUMERICS_SIMD_SSE2
+	template <>
+	struct Packet<float, 4> {
+		enum { WIDTH = 4 };
+		__m128 value;
+
+		static Packet load (const float * p) { return {_mm_loadu_ps(p)}; }
+		static Packet broadcast (const float & v) { return {_mm_set1_ps(v)}; }
+		void store (float * p) const { _mm_storeu_ps(p, value); }
+
+		Packet operator+ (const Packet & other) const { return {_mm_add_ps(value, other.value)}; }
+		Packet operator- (const Packet & other) const { return {_mm_sub_ps(value, other.value)}; }
+		Packet operator* (const Packet & other) const { return {_mm_mul_ps(value, other.value)}; }
+		Packet operator/ (const Packet & other) const { return {_mm_div_ps(value, other.value)}; }
+
+		Packet minimum (const Packet & other) const { return {_mm_min_ps(value, other.value)}; }
+		Packet maximum (const Packet & other) const { return {_mm_max_ps(value, other.value)}; }
+		Packet square_root () const { return {_mm_sqrt_ps(value)}; }
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			__m128 mask = _mm_cmpgt_ps(value, threshold.value);
+			return {_mm_or_ps(_mm_and_ps(mask, a.value), _mm_andnot_ps(mask, b.value))};
+		}
+
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const { return {_mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X))}; }
+	};
+
+	template <>
+	struct Packet<double, 2> {
+		enum { WIDTH = 2 };
+		__m128d value;
+
+		static Packet load (const double * p) { return {_mm_loadu_pd(p)}; }
+		static Packet broadcast (const double & v) { return {_mm_set1_pd(v)}; }
+		void store (double * p) const { _mm_storeu_pd(p, value); }
+
+		Packet operator+ (const Packet & other) const { return {_mm_add_pd(value, other.value)}; }
+		Packet operator- (const Packet & other) const { return {_mm_sub_pd(value, other.value)}; }
+		Packet operator* (const Packet & other) const { return {_mm_mul_pd(value, other.value)}; }
+		Packet operator/ (const Packet & other) const { return {_mm_div_pd(value, other.value)}; }
+
+		Packet minimum (const Packet & other) const { return {_mm_min_pd(value, other.value)}; }
+		Packet maximum (const Packet & other) const { return {_mm_max_pd(value, other.value)}; }
+		Packet square_root () const { return {_mm_sqrt_pd(value)}; }
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			__m128d mask = _mm_cmpgt_pd(value, threshold.value);
+			return {_mm_or_pd(_mm_and_pd(mask, a.value), _mm_andnot_pd(mask, b.value))};
+		}
+	};
+
+	// Convert four packed 3-vectors {x0 y0 z0 x1}, {y1 z1 x2 y2}, {z2 x3 y3 z3} into {x0 x1 x2 x3}, {y0 y1 y2 y3}, {z0 z1 z2 z3}:
+	inline void deinterleave (__m128 a, __m128 b, __m128 c, __m128 & x, __m128 & y, __m128 & z) {
+		__m128 x2y2x3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+		__m128 y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+
+		x = _mm_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+		z = _mm_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+	}
+
+	// The inverse of deinterleave:
+	inline void interleave (__m128 x, __m128 y, __m128 z, __m128 & a, __m128 & b, __m128 & c) {
+		__m128 x0y0x1y1 = _mm_unpacklo_ps(x, y);
+		__m128 x2y2x3y3 = _mm_unpackhi_ps(x, y);
+
+		a = _mm_shuffle_ps(x0y0x1y1, _mm_shuffle_ps(z, x0y0x1y1, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		b = _mm_shuffle_ps(_mm_shuffle_ps(x0y0x1y1, z, _MM_SHUFFLE(1, 1, 3, 3)), x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0));
+
+		__m128 z2z3x3y3 = _mm_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm_shuffle_ps(z2z3x3y3, z2z3x3y3, _MM_SHUFFLE(1, 3, 2, 0));
+	}
+
+	inline void load_vectors (const float * p, Packet<float, 4> & x, Packet<float, 4> & y, Packet<float, 4> & z) {
+		deinterleave(_mm_loadu_ps(p), _mm_loadu_ps(p + 4), _mm_loadu_ps(p + 8), x.value, y.value, z.value);
+	}
+
+	inline void store_vectors (float * p, const Packet<float, 4> & x, const Packet<float, 4> & y, const Packet<float, 4> & z) {
+		__m128 a, b, c;
+		interleave(x.value, y.value, z.value, a, b, c);
+
+		_mm_storeu_ps(p, a);
+		_mm_storeu_ps(p + 4, b);
+		_mm_storeu_ps(p + 8, c);
+	}
+
+	inline void load_quaternions (const float * p, Packet<float, 4> & x, Packet<float, 4> & y, Packet<float, 4> & z, Packet<float, 4> & w) {
+		__m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8), d = _mm_loadu_ps(p + 12);
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+
+		x.value = a; y.value = b; z.value = c; w.value = d;
+	}
+
+	inline void store_quaternions (float * p, const Packet<float, 4> & x, const Packet<float, 4> & y, const Packet<float, 4> & z, const Packet<float, 4> & w) {
+		__m128 a = x.value, b = y.value, c = z.value, d = w.value;
+		_MM_TRANSPOSE4_PS(a, b, c, d);
+
+		_mm_storeu_ps(p, a);
+		_mm_storeu_ps(p + 4, b);
+		_mm_storeu_ps(p + 8, c);
+		_mm_storeu_ps(p + 12, d);
+	}
+
+	inline unsigned equivalent_mask (const Packet<float, 4> & a, const Packet<float, 4> & b, const Tolerance<float> & tolerance) {
+		__m128 sign = _mm_set1_ps(-0.0f), one = _mm_set1_ps(1);
+		__m128 magnitude_a = _mm_andnot_ps(sign, a.value), magnitude_b = _mm_andnot_ps(sign, b.value);
+
+		// Near zero, the absolute difference is compared with epsilon:
+		__m128 near = _mm_or_ps(_mm_cmplt_ps(magnitude_a, one), _mm_cmplt_ps(magnitude_b, one));
+		__m128 absolute = _mm_cmple_ps(_mm_andnot_ps(sign, _mm_sub_ps(a.value, b.value)), _mm_set1_ps(tolerance.epsilon));
+
+		// Otherwise, the magnitudes are ordered the same as their bits, so the difference between them is the number of units in the last place, which must be within tolerance for numbers with the same sign:
+		__m128i difference = _mm_sub_epi32(_mm_castps_si128(magnitude_a), _mm_castps_si128(magnitude_b));
+		__m128i units = _mm_set1_epi32(int(tolerance.units));
+		__m128i outside = _mm_or_si128(_mm_cmpgt_epi32(difference, units), _mm_cmpgt_epi32(_mm_sub_epi32(_mm_setzero_si128(), difference), units));
+		__m128i opposite = _mm_srai_epi32(_mm_castps_si128(_mm_xor_ps(a.value, b.value)), 31);
+		__m128 within = _mm_castsi128_ps(_mm_andnot_si128(_mm_or_si128(outside, opposite), _mm_set1_epi32(-1)));
+
+		__m128 result = _mm_or_ps(_mm_and_ps(near, absolute), _mm_andnot_ps(near, within));
+
+		return unsigned(_mm_movemask_ps(_mm_and_ps(_mm_cmpord_ps(a.value, b.value), result)));
+	}
+
+#ifndef EUCLID_NUMERICS_SIMD_AVX2
+	/// Four double precision numbers are split over two registers.
+	template <>
+	struct Packet<double, 4> {
+		enum { WIDTH = 4 };
+		__m128d low, high;
+
+		static Packet load (const double * p) { return {_mm_loadu_pd(p), _mm_loadu_pd(p + 2)}; }
+		static Packet broadcast (const double & v) { return {_mm_set1_pd(v), _mm_set1_pd(v)}; }
+		void store (double * p) const { _mm_storeu_pd(p, low); _mm_storeu_pd(p + 2, high); }
+
+		static Packet load_halves (const double * low, const double * high) { return {_mm_loadu_pd(low), _mm_loadu_pd(high)}; }
+		void store_halves (double * low, double * high) const { _mm_storeu_pd(low, this->low); _mm_storeu_pd(high, this->high); }
+
+		Packet operator+ (const Packet & other) const { return {_mm_add_pd(low, other.low), _mm_add_pd(high, other.high)}; }
+		Packet operator- (const Packet & other) const { return {_mm_sub_pd(low, other.low), _mm_sub_pd(high, other.high)}; }
+		Packet operator* (const Packet & other) const { return {_mm_mul_pd(low, other.low), _mm_mul_pd(high, other.high)}; }
+		Packet operator/ (const Packet & other) const { return {_mm_div_pd(low, other.low), _mm_div_pd(high, other.high)}; }
+
+		Packet minimum (const Packet & other) const { return {_mm_min_pd(low, other.low), _mm_min_pd(high, other.high)}; }
+		Packet maximum (const Packet & other) const { return {_mm_max_pd(low, other.low), _mm_max_pd(high, other.high)}; }
+		Packet square_root () const { return {_mm_sqrt_pd(low), _mm_sqrt_pd(high)}; }
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			__m128d low_mask = _mm_cmpgt_pd(low, threshold.low), high_mask = _mm_cmpgt_pd(high, threshold.high);
+
+			return {
+				_mm_or_pd(_mm_and_pd(low_mask, a.low), _mm_andnot_pd(low_mask, b.low)),
+				_mm_or_pd(_mm_and_pd(high_mask, a.high), _mm_andnot_pd(high_mask, b.high))
+			};
+		}
+
+		// (p[A], p[B]), where p = (low, high):
+		template <int A, int B>
+		__m128d pick () const {
+			return _mm_shuffle_pd(A < 2 ? low : high, B < 2 ? low : high, (A & 1) | ((B & 1) << 1));
+		}
+
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const { return {pick<X, Y>(), pick<Z, W>()}; }
+	};
+#endif
+#endif
+
+#ifdef EUCLID_NUMERICS_SIMD_AVX2
+	template <>
+	inline Packet<float, 4> multiply_add (const Packet<float, 4> & a, const Packet<float, 4> & b, const Packet<float, 4> & c) {
+		return {_mm_fmadd_ps(a.value, b.value, c.value)};
+	}
+
+	template <>
+	inline Packet<double, 2> multiply_add (const Packet<double, 2> & a, const Packet<double, 2> & b, const Packet<double, 2> & c) {
+		return {_mm_fmadd_pd(a.value, b.value, c.value)};
+	}
+
+	template <>
+	struct Packet<float, 8> {
+		enum { WIDTH = 8 };
+		__m256 value;
+
+		static Packet load (const float * p) { return {_mm256_loadu_ps(p)}; }
+		static Packet broadcast (const float & v) { return {_mm256_set1_ps(v)}; }
+		void store (float * p) const { _mm256_storeu_ps(p, value); }
+
+		static Packet load_halves (const float * low, const float * high) { return {_mm256_loadu2_m128(high, low)}; }
+		void store_halves (float * low, float * high) const { _mm256_storeu2_m128(high, low, value); }
+
+		Packet operator+ (const Packet & other) const { return {_mm256_add_ps(value, other.value)}; }
+		Packet operator- (const Packet & other) const { return {_mm256_sub_ps(value, other.value)}; }
+		Packet operator* (const Packet & other) const { return {_mm256_mul_ps(value, other.value)}; }
+		Packet operator/ (const Packet & other) const { return {_mm256_div_ps(value, other.value)}; }
+
+		Packet minimum (const Packet & other) const { return {_mm256_min_ps(value, other.value)}; }
+		Packet maximum (const Packet & other) const { return {_mm256_max_ps(value, other.value)}; }
+		Packet square_root () const { return {_mm256_sqrt_ps(value)}; }
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			return {_mm256_blendv_ps(b.value, a.value, _mm256_cmp_ps(value, threshold.value, _CMP_GT_OQ))};
+		}
+
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const { return {_mm256_permute_ps(value, _MM_SHUFFLE(W, Z, Y, X))}; }
+	};
+
+	template <>
+	struct Packet<double, 4> {
+		enum { WIDTH = 4 };
+		__m256d value;
+
+		static Packet load (const double * p) { return {_mm256_loadu_pd(p)}; }
+		static Packet broadcast (const double & v) { return {_mm256_set1_pd(v)}; }
+		void store (double * p) const { _mm256_storeu_pd(p, value); }
+
+		static Packet load_halves (const double * low, const double * high) { return {_mm256_loadu2_m128d(high, low)}; }
+		void store_halves (double * low, double * high) const { _mm256_storeu2_m128d(high, low, value); }
+
+		Packet operator+ (const Packet & other) const { return {_mm256_add_pd(value, other.value)}; }
+		Packet operator- (const Packet & other) const { return {_mm256_sub_pd(value, other.value)}; }
+		Packet operator* (const Packet & other) const { return {_mm256_mul_pd(value, other.value)}; }
+		Packet operator/ (const Packet & other) const { return {_mm256_div_pd(value, other.value)}; }
+
+		Packet minimum (const Packet & other) const { return {_mm256_min_pd(value, other.value)}; }
+		Packet maximum (const Packet & other) const { return {_mm256_max_pd(value, other.value)}; }
+		Packet square_root () const { return {_mm256_sqrt_pd(value)}; }
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			return {_mm256_blendv_pd(b.value, a.value, _mm256_cmp_pd(value, threshold.value, _CMP_GT_OQ))};
+		}
+
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const { return {_mm256_permute4x64_pd(value, _MM_SHUFFLE(W, Z, Y, X))}; }
+	};
+
+	template <>
+	inline Packet<float, 8> multiply_add (const Packet<float, 8> & a, const Packet<float, 8> & b, const Packet<float, 8> & c) {
+		return {_mm256_fmadd_ps(a.value, b.value, c.value)};
+	}
+
+	template <>
+	inline Packet<double, 4> multiply_add (const Packet<double, 4> & a, const Packet<double, 4> & b, const Packet<double, 4> & c) {
+		return {_mm256_fmadd_pd(a.value, b.value, c.value)};
+	}
+
+	// The same as the 128-bit deinterleave, independently in each half, so the first four vectors are loaded into the low half and the second four into the high half:
+	inline void deinterleave (__m256 a, __m256 b, __m256 c, __m256 & x, __m256 & y, __m256 & z) {
+		__m256 x2y2x3y3 = _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+		__m256 y0z0y1z1 = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+
+		x = _mm256_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm256_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+		z = _mm256_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+	}
+
+	inline void interleave (__m256 x, __m256 y, __m256 z, __m256 & a, __m256 & b, __m256 & c) {
+		__m256 x0y0x1y1 = _mm256_unpacklo_ps(x, y);
+		__m256 x2y2x3y3 = _mm256_unpackhi_ps(x, y);
+
+		a = _mm256_shuffle_ps(x0y0x1y1, _mm256_shuffle_ps(z, x0y0x1y1, _MM_SHUFFLE(2, 2, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0));
+		b = _mm256_shuffle_ps(_mm256_shuffle_ps(x0y0x1y1, z, _MM_SHUFFLE(1, 1, 3, 3)), x2y2x3y3, _MM_SHUFFLE(1, 0, 2, 0));
+
+		__m256 z2z3x3y3 = _mm256_shuffle_ps(z, x2y2x3y3, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm256_shuffle_ps(z2z3x3y3, z2z3x3y3, _MM_SHUFFLE(1, 3, 2, 0));
+	}
+
+	inline void load_vectors (const float * p, Packet<float, 8> & x, Packet<float, 8> & y, Packet<float, 8> & z) {
+		deinterleave(_mm256_loadu2_m128(p + 12, p), _mm256_loadu2_m128(p + 16, p + 4), _mm256_loadu2_m128(p + 20, p + 8), x.value, y.value, z.value);
+	}
+
+	inline void store_vectors (float * p, const Packet<float, 8> & x, const Packet<float, 8> & y, const Packet<float, 8> & z) {
+		__m256 a, b, c;
+		interleave(x.value, y.value, z.value, a, b, c);
+
+		_mm256_storeu2_m128(p + 12, p, a);
+		_mm256_storeu2_m128(p + 16, p + 4, b);
+		_mm256_storeu2_m128(p + 20, p + 8, c);
+	}
+
+	// Transpose the 4x4 matrix in each 128-bit half, which is its own inverse:
+	inline void transpose (__m256 & a, __m256 & b, __m256 & c, __m256 & d) {
+		__m256 x0x1y0y1 = _mm256_unpacklo_ps(a, b), x2x3y2y3 = _mm256_unpacklo_ps(c, d);
+		__m256 z0z1w0w1 = _mm256_unpackhi_ps(a, b), z2z3w2w3 = _mm256_unpackhi_ps(c, d);
+
+		a = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(1, 0, 1, 0));
+		b = _mm256_shuffle_ps(x0x1y0y1, x2x3y2y3, _MM_SHUFFLE(3, 2, 3, 2));
+		c = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(1, 0, 1, 0));
+		d = _mm256_shuffle_ps(z0z1w0w1, z2z3w2w3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	inline void load_quaternions (const float * p, Packet<float, 8> & x, Packet<float, 8> & y, Packet<float, 8> & z, Packet<float, 8> & w) {
+		__m256 a = _mm256_loadu2_m128(p + 16, p), b = _mm256_loadu2_m128(p + 20, p + 4), c = _mm256_loadu2_m128(p + 24, p + 8), d = _mm256_loadu2_m128(p + 28, p + 12);
+		transpose(a, b, c, d);
+
+		x.value = a; y.value = b; z.value = c; w.value = d;
+	}
+
+	inline void store_quaternions (float * p, const Packet<float, 8> & x, const Packet<float, 8> & y, const Packet<float, 8> & z, const Packet<float, 8> & w) {
+		__m256 a = x.value, b = y.value, c = z.value, d = w.value;
+		transpose(a, b, c, d);
+
+		_mm256_storeu2_m128(p + 16, p, a);
+		_mm256_storeu2_m128(p + 20, p + 4, b);
+		_mm256_storeu2_m128(p + 24, p + 8, c);
+		_mm256_storeu2_m128(p + 28, p + 12, d);
+	}
+
+	/// The same as the 128-bit version, for eight lanes.
+	inline unsigned equivalent_mask (const Packet<float, 8> & a, const Packet<float, 8> & b, const Tolerance<float> & tolerance) {
+		__m256 sign = _mm256_set1_ps(-0.0f), one = _mm256_set1_ps(1);
+		__m256 magnitude_a = _mm256_andnot_ps(sign, a.value), magnitude_b = _mm256_andnot_ps(sign, b.value);
+
+		__m256 near = _mm256_or_ps(_mm256_cmp_ps(magnitude_a, one, _CMP_LT_OQ), _mm256_cmp_ps(magnitude_b, one, _CMP_LT_OQ));
+		__m256 absolute = _mm256_cmp_ps(_mm256_andnot_ps(sign, _mm256_sub_ps(a.value, b.value)), _mm256_set1_ps(tolerance.epsilon), _CMP_LE_OQ);
+
+		__m256i difference = _mm256_sub_epi32(_mm256_castps_si256(magnitude_a), _mm256_castps_si256(magnitude_b));
+		__m256i units = _mm256_set1_epi32(int(tolerance.units));
+		__m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(difference, units), _mm256_cmpgt_epi32(_mm256_sub_epi32(_mm256_setzero_si256(), difference), units));
+		__m256i opposite = _mm256_srai_epi32(_mm256_castps_si256(_mm256_xor_ps(a.value, b.value)), 31);
+		__m256 within = _mm256_castsi256_ps(_mm256_andnot_si256(_mm256_or_si256(outside, opposite), _mm256_set1_epi32(-1)));
+
+		__m256 result = _mm256_or_ps(_mm256_and_ps(near, absolute), _mm256_andnot_ps(near, within));
+
+		return unsigned(_mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(a.value, b.value, _CMP_ORD_Q), result)));
+	}
+#endif
+
+#ifdef EUCLID_NUMERICS_SIMD_NEON
+	template <>
+	struct Packet<float, 4> {
+		enum { WIDTH = 4 };
+		float32x4_t value;
+
+		static Packet load (const float * p) { return {vld1q_f32(p)}; }
+		static Packet broadcast (const float & v) { return {vdupq_n_f32(v)}; }
+		void store (float * p) const { vst1q_f32(p, value); }
+
+		Packet operator+ (const Packet & other) const { return {vaddq_f32(value, other.value)}; }
+		Packet operator- (const Packet & other) const { return {vsubq_f32(value, other.value)}; }
+		Packet operator* (const Packet & other) const { return {vmulq_f32(value, other.value)}; }
+
+		Packet minimum (const Packet & other) const { return {vminq_f32(value, other.value)}; }
+		Packet maximum (const Packet & other) const { return {vmaxq_f32(value, other.value)}; }
+
+#ifdef __aarch64__
+		Packet operator/ (const Packet & other) const { return {vdivq_f32(value, other.value)}; }
+		Packet square_root () const { return {vsqrtq_f32(value)}; }
+#else
+		// ARMv7 has no vector division or square root, and the estimates aren't accurate enough:
+		Packet operator/ (const Packet & other) const {
+			float a[4], b[4];
+			store(a); other.store(b);
+			for (std::size_t i = 0; i < 4; i += 1) a[i] /= b[i];
+			return load(a);
+		}
+
+		Packet square_root () const {
+			float a[4];
+			store(a);
+			for (std::size_t i = 0; i < 4; i += 1) a[i] = std::sqrt(a[i]);
+			return load(a);
+		}
+#endif
+
+		Packet select_greater (const Packet & threshold, const Packet & a, const Packet & b) const {
+			return {vbslq_f32(vcgtq_f32(value, threshold.value), a.value, b.value)};
+		}
+
+		template <int X, int Y, int Z, int W>
+		Packet swizzle () const {
+			float a[4];
+			store(a);
+			float b[4] = {a[X], a[Y], a[Z], a[W]};
+			return load(b);
+		}
+	};
+
+	inline void load_vectors (const float * p, Packet<float, 4> & x, Packet<float, 4> & y, Packet<float, 4> & z) {
+		float32x4x3_t v = vld3q_f32(p);
+
+		x.value = v.val[0];
+		y.value = v.val[1];
+		z.value = v.val[2];
+	}
+
+	inline void store_vectors (float * p, const Packet<float, 4> & x, const Packet<float, 4> & y, const Packet<float, 4> & z) {
+		float32x4x3_t v = {{x.value, y.value, z.value}};
+
+		vst3q_f32(p, v);
+	}
+
+	inline void load_quaternions (const float * p, Packet<float, 4> & x, Packet<float, 4> & y, Packet<float, 4> & z, Packet<float, 4> & w) {
+		float32x4x4_t v = vld4q_f32(p);
+
+		x.value = v.val[0];
+		y.value = v.val[1];
+		z.value = v.val[2];
+		w.value = v.val[3];
+	}
+
+	inline void store_quaternions (float * p, const Packet<float, 4> & x, const Packet<float, 4> & y, const Packet<float, 4> & z, const Packet<float, 4> & w) {
+		float32x4x4_t v = {{x.value, y.value, z.value, w.value}};
+
+		vst4q_f32(p, v);
+	}
+
+	inline unsigned equivalent_mask (const Packet<float, 4> & a, const Packet<float, 4> & b, const Tolerance<float> & tolerance) {
+		float32x4_t one = vdupq_n_f32(1);
+		uint32x4_t bits_a = vreinterpretq_u32_f32(a.value), bits_b = vreinterpretq_u32_f32(b.value), magnitude = vdupq_n_u32(0x7fffffff);
+
+		uint32x4_t near = vorrq_u32(vcltq_f32(vabsq_f32(a.value), one), vcltq_f32(vabsq_f32(b.value), one));
+		uint32x4_t absolute = vcleq_f32(vabdq_f32(a.value, b.value), vdupq_n_f32(tolerance.epsilon));
+
+		// The magnitudes are ordered the same as their bits, so their difference is the number of units in the last place:
+		uint32x4_t units = vcleq_u32(vabdq_u32(vandq_u32(bits_a, magnitude), vandq_u32(bits_b, magnitude)), vdupq_n_u32(tolerance.units));
+		uint32x4_t same_sign = vcgeq_s32(vreinterpretq_s32_u32(veorq_u32(bits_a, bits_b)), vdupq_n_s32(0));
+		uint32x4_t ordered = vandq_u32(vceqq_f32(a.value, a.value), vceqq_f32(b.value, b.value));
+
+		uint32_t lanes[4];
+		vst1q_u32(lanes, vandq_u32(ordered, vbslq_u32(near, absolute, vandq_u32(units, same_sign))));
+
+		return (lanes[0] & 1) | (lanes[1] & 2) | (lanes[2] & 4) | (lanes[3] & 8);
+	}
+#endif
+}
+
@@ -0,0 +1,175 @@
+//
+//  Numerics/ThreadPool.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			/// The pool whose job the current thread is running, if any.
+			thread_local const ThreadPool * running_pool = nullptr;
+
+			std::size_t hardware_threads ()
+			{
+				return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+			}
+		}
+
+		ThreadPool::ThreadPool (std::size_t workers)
+		{
+			for (std::size_t i = 0; i < workers; i += 1)
+				_workers.emplace_back(&ThreadPool::run_worker, this);
+		}
+
+		ThreadPool::~ThreadPool ()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_stopping = true;
+			}
+
+			_start.notify_all();
+
+			for (auto & worker : _workers)
+				worker.join();
+		}
+
+		void ThreadPool::work ()
+		{
+			try {
+				for (std::size_t index = _next++; index < _count; index = _next++)
+					(*_function)(index);
+			} catch (...) {
+				// Stop the other threads from starting more tasks:
+				_next = _count;
+
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				if (!_exception)
+					_exception = std::current_exception();
+			}
+		}
+
+		void ThreadPool::run_worker ()
+		{
+			running_pool = this;
+
+			std::size_t generation = 0;
+			std::unique_lock<std::mutex> lock(_mutex);
+
+			while (true) {
+				_start.wait(lock, [&]{return _stopping || _generation != generation;});
+
+				if (_stopping) return;
+
+				generation = _generation;
+
+				// The job may need fewer threads than there are workers:
+				if (_joining == 0) continue;
+
+				_joining -= 1;
+				_active += 1;
+
+				lock.unlock();
+				work();
+				lock.lock();
+
+				if (--_active == 0)
+					_finish.notify_all();
+			}
+		}
+
+		void ThreadPool::run (std::size_t count, std::size_t threads, const std::function<void (std::size_t index)> & function)
+		{
+			if (threads == 0)
+				threads = size();
+
+			threads = std::min({threads, size(), count});
+
+			if (threads <= 1 || running_pool == this || !_job_mutex.try_lock()) {
+				for (std::size_t index = 0; index < count; index += 1)
+					function(index);
+
+				return;
+			}
+
+			std::lock_guard<std::mutex> job(_job_mutex, std::adopt_lock);
+
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+
+				_function = &function;
+				_count = count;
+				_next = 0;
+				_joining = threads - 1;
+				_generation += 1;
+			}
+
+			_start.notify_all();
+
+			const ThreadPool * previous = running_pool;
+
+			running_pool = this;
+			work();
+			running_pool = previous;
+
+			// Workers which haven't joined yet aren't needed, since every task has been taken:
+			std::unique_lock<std::mutex> lock(_mutex);
+			_joining = 0;
+			_finish.wait(lock, [&]{return _active == 0;});
+
+			_function = nullptr;
+
+			std::exception_ptr exception;
+			std::swap(exception, _exception);
+
+			if (exception)
+				std::rethrow_exception(exception);
+		}
+
+		ThreadPool & ThreadPool::shared ()
+		{
+			static ThreadPool pool(hardware_threads() - 1);
+
+			return pool;
+		}
+
+		std::size_t thread_count (std::size_t count, std::size_t threads, std::size_t minimum_range)
+		{
+			if (threads == 0)
+				threads = hardware_threads();
+
+			return std::min(threads, std::max<std::size_t>(count / std::max<std::size_t>(minimum_range, 1), 1));
+		}
+
+		void parallel_for (std::size_t count, std::size_t threads, const std::function<void (std::size_t index)> & function)
+		{
+			ThreadPool::shared().run(count, threads, function);
+		}
+
+		void parallel_ranges (std::size_t count, std::size_t threads, const std::function<void (std::size_t begin, std::size_t end)> & function, std::size_t alignment)
+		{
+			if (count == 0) return;
+
+			threads = thread_count(count, threads);
+
+			std::size_t range = (count + threads - 1) / threads;
+			range = (range + alignment - 1) / alignment * alignment;
+
+			std::size_t ranges = (count + range - 1) / range;
+
+			parallel_for(ranges, ranges, [&](std::size_t index) {
+				std::size_t begin = index * range;
+
+				function(begin, std::min(begin + range, count));
+			});
+		}
+	}
+}
@@ -0,0 +1,86 @@
+//
+//  Numerics/ThreadPool.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_THREAD_POOL_H
+#define _EUCLID_NUMERICS_THREAD_POOL_H
+
+#include "Numerics.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// A fixed set of worker threads which run the tasks of one job at a time, so that concurrent functions don't start and join threads every time they are called.
+		class ThreadPool
+		{
+		protected:
+			std::vector<std::thread> _workers;
+
+			std::mutex _mutex;
+			std::condition_variable _start, _finish;
+
+			/// Held by the thread which is running a job.
+			std::mutex _job_mutex;
+
+			const std::function<void (std::size_t)> * _function = nullptr;
+			std::size_t _count = 0;
+			std::atomic<std::size_t> _next{0};
+
+			/// Incremented for each job, so that waiting workers know there is a new one.
+			std::size_t _generation = 0;
+
+			/// The number of workers which may still join the current job, and the number which are running it.
+			std::size_t _joining = 0, _active = 0;
+
+			bool _stopping = false;
+
+			/// The first exception thrown by a task of the current job, which is rethrown by run.
+			std::exception_ptr _exception;
+
+			void work ();
+			void run_worker ();
+
+		public:
+			/// Start the given number of worker threads. The thread which runs a job also runs its tasks, so a pool with no workers runs every job on the calling thread.
+			ThreadPool (std::size_t workers);
+
+			ThreadPool (const ThreadPool &) = delete;
+			ThreadPool & operator= (const ThreadPool &) = delete;
+
+			~ThreadPool ();
+
+			/// The maximum number of threads which run a job, including the calling thread.
+			std::size_t size () const { return _workers.size() + 1; }
+
+			/// Call function(index) for each index < count, on up to the given number of threads including the calling thread, or all of them if zero, and return once every task has finished. Tasks are taken in order by whichever thread is free. If a task throws, no more tasks are started, and the first exception is rethrown once the running tasks have finished. If the pool is already running a job, e.g. when called from a task, the tasks are run on the calling thread instead.
+			void run (std::size_t count, std::size_t threads, const std::function<void (std::size_t index)> & function);
+
+			/// The pool used by the library, which has one worker for each hardware thread apart from the calling thread. It is started the first time it is used.
+			static ThreadPool & shared ();
+		};
+
+		/// Smaller ranges are not worth the cost of waking a thread.
+		constexpr std::size_t MINIMUM_PARALLEL_RANGE = 4096;
+
+		/// The number of threads to use for count items, which is at most the given number of threads, or one per hardware thread if zero, and gives each thread at least minimum_range items.
+		std::size_t thread_count (std::size_t count, std::size_t threads, std::size_t minimum_range = MINIMUM_PARALLEL_RANGE);
+
+		/// Call function(index) for each index < count on up to the given number of threads of the shared pool, see ThreadPool::run.
+		void parallel_for (std::size_t count, std::size_t threads, const std::function<void (std::size_t index)> & function);
+
+		/// Split [0, count) into one contiguous range per thread, see thread_count, and call function(begin, end) for each range on the shared pool. Every range apart from the last is a multiple of alignment.
+		void parallel_ranges (std::size_t count, std::size_t threads, const std::function<void (std::size_t begin, std::size_t end)> & function, std::size_t alignment = 1);
+	}
+}
+
+#endif
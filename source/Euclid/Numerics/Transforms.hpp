@@ -14,35 +14,79 @@
 
 namespace Euclid {
 	namespace Numerics {
+		/// Apply a single transform to the accumulated result, i.e. to = to * transform. Types such as Matrix provide more specific overloads which update the result directly.
+		template <typename ApplyT, typename TransformT>
+		constexpr void compose (ApplyT & to, const TransformT & transform)
+		{
+			to *= ApplyT(transform);
+		}
+
+		/// Whether a transform has no effect. Transforms which can't tell, e.g. Matrix, are assumed to have an effect.
+		template <typename TransformT>
+		constexpr auto is_identity (const TransformT & transform, int = 0) -> decltype(bool(transform.identity()))
+		{
+			return transform.identity();
+		}
+
+		template <typename TransformT>
+		constexpr bool is_identity (const TransformT &, long = 0)
+		{
+			return false;
+		}
+
+		/// Combine a pending transform with the next one in a chain. By default, the pending transform is composed into the result, unless it is the identity, and the next transform becomes pending. Consecutive transforms of the same kind provide overloads which merge them into a single pending transform instead.
+		template <typename ApplyT, typename PendingT, typename TransformT>
+		constexpr TransformT fold (ApplyT & to, const PendingT & pending, const TransformT & transform)
+		{
+			if (!is_identity(pending, 0))
+				compose(to, pending);
+
+			return transform;
+		}
+
 		template <typename LeftT, typename RightT>
 		struct Transforms {
 			const LeftT left;
 			const RightT right;
 
 		protected:
+			template <typename ApplyT, typename PendingT, typename TransformT>
+			static constexpr auto accumulate(ApplyT & to, const PendingT & pending, const TransformT & transform)
+			{
+				return fold(to, pending, transform);
+			}
+
+			template <typename ApplyT, typename PendingT, typename A, typename B>
+			static constexpr auto accumulate(ApplyT & to, const PendingT & pending, const Transforms<A, B> & transforms)
+			{
+				return accumulate(to, accumulate(to, pending, transforms.left), transforms.right);
+			}
+
 			template <typename ApplyT, typename TransformT>
-			void apply(ApplyT & to, const TransformT & transform) const
+			static constexpr TransformT first(ApplyT &, const TransformT & transform)
 			{
-				//if (!transform.identity())
-				to *= ApplyT(transform);
+				return transform;
 			}
 
 			template <typename ApplyT, typename A, typename B>
-			void apply(ApplyT & to, const Transforms<A, B> & transforms) const
+			static constexpr auto first(ApplyT & to, const Transforms<A, B> & transforms)
 			{
-				apply(to, transforms.left);
-				apply(to, transforms.right);
+				return accumulate(to, first(to, transforms.left), transforms.right);
 			}
 
 		public:
+			/// Right-multiply the chain, from left to right, into the given result. Identity links are skipped and consecutive links of the same kind are merged before they are composed.
 			template <typename ApplyT>
-			void apply (ApplyT & to) const {
-				apply(to, *this);
+			constexpr void apply (ApplyT & to) const {
+				auto pending = first(to, *this);
+
+				if (!is_identity(pending, 0))
+					compose(to, pending);
 			}
 		};
 
 		template <typename A, typename B, typename RightT>
-		Transforms<Transforms<A, B>, RightT> operator<< (const Transforms<A, B> & list, const RightT & right) {
+		constexpr Transforms<Transforms<A, B>, RightT> operator<< (const Transforms<A, B> & list, const RightT & right) {
 			return {list, right};
 		}
 
@@ -54,20 +98,33 @@ namespace Euclid {
 			/// The offset to translate by:
 			Vector<E, NumericT> offset;
 
-			bool identity () const { return offset.sum() == 1; }
+			constexpr bool identity () const
+			{
+				for (dimension i = 0; i < E; i += 1)
+					if (offset[i] != 0) return false;
+
+				return true;
+			}
 
 			template <typename RightT>
-			Transforms<Translation, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<Translation, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
 		};
 
 		template <dimension E, typename NumericT>
-		Translation<E, NumericT> translate (const Vector<E, NumericT> & offset) {
+		constexpr Translation<E, NumericT> translate (const Vector<E, NumericT> & offset) {
 			return {offset};
 		}
 
+		/// Consecutive translations are equivalent to a single translation by their sum.
+		template <typename ApplyT, dimension E, typename NumericT>
+		constexpr Translation<E, NumericT> fold (ApplyT &, const Translation<E, NumericT> & pending, const Translation<E, NumericT> & translation)
+		{
+			return {pending.offset + translation.offset};
+		}
+
 		// MARK: -
 		// MARK: Scale
 
@@ -75,38 +132,56 @@ namespace Euclid {
 		struct Scale {
 			Vector<E, NumericT> factor;
 
-			bool identity () const { return factor == 1; }
+			constexpr bool identity () const
+			{
+				for (dimension i = 0; i < E; i += 1)
+					if (factor[i] != 1) return false;
+
+				return true;
+			}
 
 			template <typename RightT>
-			Transforms<Scale, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<Scale, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
 		};
 
 		template <dimension E, typename NumericT>
-		Scale<E, NumericT> scale (const Vector<E, NumericT> & factor) {
+		constexpr Scale<E, NumericT> scale (const Vector<E, NumericT> & factor) {
 			return {factor};
 		}
 
+		template <typename ApplyT, dimension E, typename NumericT>
+		constexpr Scale<E, NumericT> fold (ApplyT &, const Scale<E, NumericT> & pending, const Scale<E, NumericT> & scale)
+		{
+			return {pending.factor * scale.factor};
+		}
+
 		template <typename NumericT>
 		struct UniformScale {
 			NumericT factor;
 
-			bool identity () const { return factor == 1; }
+			constexpr bool identity () const { return factor == 1; }
 
 			template <typename RightT>
-			Transforms<UniformScale, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<UniformScale, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
 		};
 
 		template <typename NumericT>
-		UniformScale<NumericT> scale (const NumericT & factor) {
+		constexpr UniformScale<NumericT> scale (const NumericT & factor) {
 			return {factor};
 		}
 
+		template <typename ApplyT, typename NumericT>
+		constexpr UniformScale<NumericT> fold (ApplyT &, const UniformScale<NumericT> & pending, const UniformScale<NumericT> & scale)
+		{
+			return {pending.factor * scale.factor};
+		}
+
 		// MARK: -
 		// MARK: Fixed Axis Rotation
 
@@ -115,10 +190,10 @@ namespace Euclid {
 		struct FixedAxisRotation {
 			Radians<NumericT> angle;
 
-			bool identity () const { return angle == 0; }
+			constexpr bool identity () const { return angle == 0; }
 
 			template <dimension E>
-			Vector<E, NumericT> axis () const
+			constexpr Vector<E, NumericT> axis () const
 			{
 				Vector<E, NumericT> result = 0;
 
@@ -128,7 +203,7 @@ namespace Euclid {
 			}
 
 			template <typename RightT>
-			Transforms<FixedAxisRotation, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<FixedAxisRotation, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
@@ -136,10 +211,17 @@ namespace Euclid {
 
 		/// Rotation around a fixed axis: rotation<X>(R90)
 		template <dimension AXIS, typename NumericT>
-		FixedAxisRotation<AXIS, NumericT> rotate(const Radians<NumericT> & angle) {
+		constexpr FixedAxisRotation<AXIS, NumericT> rotate(const Radians<NumericT> & angle) {
 			return {angle};
 		}
 
+		/// Consecutive rotations around the same fixed axis are equivalent to a single rotation by the sum of their angles.
+		template <typename ApplyT, dimension AXIS, typename NumericT>
+		constexpr FixedAxisRotation<AXIS, NumericT> fold (ApplyT &, const FixedAxisRotation<AXIS, NumericT> & pending, const FixedAxisRotation<AXIS, NumericT> & rotation)
+		{
+			return {pending.angle + rotation.angle};
+		}
+
 		// MARK: -
 		// MARK: Angle Axis Rotation
 
@@ -159,17 +241,17 @@ namespace Euclid {
 				return {*this, origin};
 			}
 
-			bool identity () const { return angle == 0; }
+			constexpr bool identity () const { return angle == 0; }
 
 			template <typename RightT>
-			Transforms<AngleAxisRotation, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<AngleAxisRotation, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
 		};
 
 		template <dimension E, typename AngleNumericT, typename AxisNumericT>
-		AngleAxisRotation<E, AngleNumericT, AxisNumericT> rotate(const Radians<AngleNumericT> & angle, const Vector<E, AxisNumericT> & axis) {
+		constexpr AngleAxisRotation<E, AngleNumericT, AxisNumericT> rotate(const Radians<AngleNumericT> & angle, const Vector<E, AxisNumericT> & axis) {
 			return {angle, axis};
 		}
 
@@ -191,10 +273,10 @@ namespace Euclid {
 			AngleAxisRotation<E, AngleNumericT, AxisNumericT> rotation;
 			Vector<E, AxisNumericT> origin;
 
-			bool identity () const { return rotation.identity(); }
+			constexpr bool identity () const { return rotation.identity(); }
 
 			template <typename RightT>
-			Transforms<OffsetAngleAxisRotation, RightT> operator<< (const RightT & right) const
+			constexpr Transforms<OffsetAngleAxisRotation, RightT> operator<< (const RightT & right) const
 			{
 				return {*this, right};
 			}
@@ -0,0 +1,155 @@
+//
+//  Numerics/Trigonometry.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The fast trigonometry kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the namespace of each instruction set. Each kernel follows the scalar approximation in Trigonometry.hpp, with the branches replaced by selections.
+
+namespace {
+	/// Round to the nearest integer, with ties to even, by adding and subtracting 1.5 * 2^23, which is exact for |v| < 2^22.
+	template <typename PacketT>
+	inline PacketT round_nearest (const PacketT & v)
+	{
+		PacketT magic = PacketT::broadcast(12582912.0f);
+
+		return (v + magic) - magic;
+	}
+
+	template <std::size_t WIDTH>
+	inline void sin_cos_packed (const float * angles, float * sines, float * cosines)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+		typedef TrigonometryCoefficients<float> CoefficientsT;
+
+		PacketT angle = PacketT::load(angles);
+
+		PacketT j = round_nearest(angle * PacketT::broadcast(CoefficientsT::TWO_OVER_PI));
+		PacketT r = ((angle - j * PacketT::broadcast(CoefficientsT::PI_2_A)) - j * PacketT::broadcast(CoefficientsT::PI_2_B)) - j * PacketT::broadcast(CoefficientsT::PI_2_C);
+		PacketT z = r * r;
+
+		PacketT half = PacketT::broadcast(0.5f), one = PacketT::broadcast(1);
+
+		PacketT s = multiply_add(r * z, multiply_add(z, multiply_add(z, PacketT::broadcast(CoefficientsT::S[2]), PacketT::broadcast(CoefficientsT::S[1])), PacketT::broadcast(CoefficientsT::S[0])), r);
+		PacketT c = multiply_add(z * z, multiply_add(z, multiply_add(z, PacketT::broadcast(CoefficientsT::C[2]), PacketT::broadcast(CoefficientsT::C[1])), PacketT::broadcast(CoefficientsT::C[0])), one - half * z);
+
+		// The quadrant is j modulo 4, and odd quadrants swap the sine and cosine. Both are computed from j by rounding, since the packets have no integer operations:
+		PacketT quadrant = j - PacketT::broadcast(4) * round_nearest(j * PacketT::broadcast(0.25f) - PacketT::broadcast(0.375f));
+		PacketT odd = quadrant - PacketT::broadcast(2) * round_nearest(quadrant * half - PacketT::broadcast(0.25f));
+
+		PacketT sine = odd.select_greater(half, c, s), cosine = odd.select_greater(half, s, c);
+
+		// The sine is negative in quadrants 2 and 3, and the cosine in quadrants 1 and 2, i.e. where (quadrant - 1.5)^2 < 1:
+		PacketT minus_one = PacketT::broadcast(-1), centered = quadrant - PacketT::broadcast(1.5f);
+
+		sine = sine * quadrant.select_greater(PacketT::broadcast(1.5f), minus_one, one);
+		cosine = cosine * (centered * centered).select_greater(one, one, minus_one);
+
+		sine.store(sines);
+		cosine.store(cosines);
+	}
+
+	template <std::size_t WIDTH>
+	inline void acos_packed (const float * values, float * angles)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+		typedef TrigonometryCoefficients<float> CoefficientsT;
+
+		PacketT x = PacketT::load(values);
+
+		PacketT zero = PacketT::broadcast(0), half = PacketT::broadcast(0.5f), one = PacketT::broadcast(1);
+		PacketT a = x.maximum(zero - x).minimum(one);
+
+		// Both ranges are evaluated with the same polynomial, by selecting its argument:
+		PacketT outer_z = half * (one - a);
+		PacketT z = a.select_greater(half, outer_z, x * x);
+		PacketT b = a.select_greater(half, outer_z.square_root(), x);
+
+		PacketT p = PacketT::broadcast(CoefficientsT::A[0]);
+		for (std::size_t i = 1; i < 5; i += 1)
+			p = multiply_add(p, z, PacketT::broadcast(CoefficientsT::A[i]));
+
+		PacketT r = multiply_add(b * z, p, b);
+
+		PacketT outer = zero.select_greater(x, PacketT::broadcast(CoefficientsT::PI) - (r + r), r + r);
+		PacketT angle = a.select_greater(half, outer, PacketT::broadcast(CoefficientsT::PI_2) - r);
+
+		angle.store(angles);
+	}
+
+	template <std::size_t WIDTH>
+	inline void atan2_packed (const float * ys, const float * xs, float * angles)
+	{
+		typedef Packet<float, WIDTH> PacketT;
+		typedef TrigonometryCoefficients<float> CoefficientsT;
+
+		PacketT y = PacketT::load(ys), x = PacketT::load(xs);
+
+		PacketT zero = PacketT::broadcast(0), one = PacketT::broadcast(1);
+		PacketT ax = x.maximum(zero - x), ay = y.maximum(zero - y);
+
+		PacketT ratio = ax.minimum(ay) / ax.maximum(ay).maximum(PacketT::broadcast(std::numeric_limits<float>::min()));
+
+		PacketT tan_pi_8 = PacketT::broadcast(CoefficientsT::TAN_PI_8);
+		PacketT t = ratio.select_greater(tan_pi_8, (ratio - one) / (ratio + one), ratio);
+
+		PacketT z = t * t;
+
+		PacketT q = PacketT::broadcast(CoefficientsT::T[0]);
+		for (std::size_t i = 1; i < 4; i += 1)
+			q = multiply_add(q, z, PacketT::broadcast(CoefficientsT::T[i]));
+
+		PacketT r = multiply_add(q * z, t, t);
+
+		r = ratio.select_greater(tan_pi_8, PacketT::broadcast(CoefficientsT::PI_4) + r, r);
+		r = ay.select_greater(ax, PacketT::broadcast(CoefficientsT::PI_2) - r, r);
+		r = zero.select_greater(x, PacketT::broadcast(CoefficientsT::PI) - r, r);
+		r = zero.select_greater(y, zero - r, r);
+
+		r.store(angles);
+	}
+}
+
+void fast_sin_cos(const float * angles, float * sines, float * cosines, std::size_t count) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		sin_cos_packed<8>(angles + i, sines + i, cosines + i);
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		sin_cos_packed<4>(angles + i, sines + i, cosines + i);
+
+	for (; i < count; i += 1)
+		sin_cos_packed<1>(angles + i, sines + i, cosines + i);
+}
+
+void fast_acos(const float * values, float * angles, std::size_t count) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		acos_packed<8>(values + i, angles + i);
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		acos_packed<4>(values + i, angles + i);
+
+	for (; i < count; i += 1)
+		acos_packed<1>(values + i, angles + i);
+}
+
+void fast_atan2(const float * y, const float * x, float * angles, std::size_t count) {
+	std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+	for (; i + 8 <= count; i += 8)
+		atan2_packed<8>(y + i, x + i, angles + i);
+#endif
+
+	for (; i + 4 <= count; i += 4)
+		atan2_packed<4>(y + i, x + i, angles + i);
+
+	for (; i < count; i += 1)
+		atan2_packed<1>(y + i, x + i, angles + i);
+}
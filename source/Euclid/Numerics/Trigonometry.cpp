@@ -0,0 +1,27 @@
+//
+//  Numerics/Trigonometry.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "Trigonometry.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		void fast_sin_cos(const float * angles, float * sines, float * cosines, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(fast_sin_cos(angles, sines, cosines, count))
+		}
+
+		void fast_acos(const float * values, float * angles, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(fast_acos(values, angles, count))
+		}
+
+		void fast_atan2(const float * y, const float * x, float * angles, std::size_t count) {
+			EUCLID_NUMERICS_KERNELS_CALL(fast_atan2(y, x, angles, count))
+		}
+	}
+}
+
+#endif
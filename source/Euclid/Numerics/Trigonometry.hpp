@@ -0,0 +1,192 @@
+//
+//  Numerics/Trigonometry.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_TRIGONOMETRY_H
+#define _EUCLID_NUMERICS_TRIGONOMETRY_H
+
+#include "Instructions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+// Fast approximations of the trigonometric functions, which use polynomials rather than calling the standard library, and are vectorized by the batch functions. They are accurate to single precision, so in double precision they are only useful where that is good enough.
+//
+// The maximum error compared with the correctly rounded result, in single precision, including the batch functions on every instruction set:
+//
+//	fast_sin_cos: 2 ULP for |angle| <= 8192 where the result is larger than 1e-3. Near the roots, the absolute error is less than 1e-7.
+//	fast_acos: 2 ULP for x in [-1, 1]. Inputs outside this range are clamped, e.g. for the dot product of two unit vectors.
+//	fast_atan2: 4 ULP. The sign of zero is ignored, so fast_atan2(-0, -1) is pi rather than -pi.
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// The constants and polynomial coefficients used by the approximations, from the Cephes library.
+		template <typename FloatT>
+		struct TrigonometryCoefficients {
+			static constexpr FloatT PI = 3.14159265358979323846;
+			static constexpr FloatT PI_2 = 1.57079632679489661923;
+			static constexpr FloatT PI_4 = 0.78539816339744830962;
+			static constexpr FloatT TWO_OVER_PI = 0.63661977236758134308;
+
+			/// pi / 2 split into three parts, so that multiples of the first two parts are exact for the supported range of angles.
+			static constexpr FloatT PI_2_A = 1.5703125;
+			static constexpr FloatT PI_2_B = 4.837512969970703125e-4;
+			static constexpr FloatT PI_2_C = 7.54978995489188216e-8;
+
+			/// sin(r) = r + r^3 * (S[0] + r^2 * (S[1] + r^2 * S[2])) for r in [-pi/4, pi/4].
+			static constexpr FloatT S[3] = {-1.6666654611e-1, 8.3321608736e-3, -1.9515295891e-4};
+
+			/// cos(r) = 1 - r^2 / 2 + r^4 * (C[0] + r^2 * (C[1] + r^2 * C[2])) for r in [-pi/4, pi/4].
+			static constexpr FloatT C[3] = {4.166664568298827e-2, -1.388731625493765e-3, 2.443315711809948e-5};
+
+			/// asin(x) = x + x^3 * P(x^2) for x in [0, 0.5], where P(z) = ((((A[0] * z + A[1]) * z + A[2]) * z + A[3]) * z + A[4]).
+			static constexpr FloatT A[5] = {4.2163199048e-2, 2.4181311049e-2, 4.5470025998e-2, 7.4953002686e-2, 1.6666752422e-1};
+
+			/// atan(x) = x + x^3 * Q(x^2) for x in [-tan(pi/8), tan(pi/8)], where Q(z) = (((T[0] * z + T[1]) * z + T[2]) * z + T[3]).
+			static constexpr FloatT T[4] = {8.05374449538e-2, -1.38776856032e-1, 1.99777106478e-1, -3.33329491539e-1};
+			static constexpr FloatT TAN_PI_8 = 0.41421356237309504880;
+		};
+
+		/// Compute the sine and cosine of an angle, by reducing it to the range [-pi/4, pi/4] and evaluating a polynomial for each.
+		template <typename FloatT>
+		void fast_sin_cos (FloatT angle, FloatT & sine, FloatT & cosine)
+		{
+			typedef TrigonometryCoefficients<FloatT> CoefficientsT;
+
+			// The nearest multiple of pi / 2, which selects the quadrant:
+			FloatT j = std::nearbyint(angle * CoefficientsT::TWO_OVER_PI);
+			FloatT r = ((angle - j * CoefficientsT::PI_2_A) - j * CoefficientsT::PI_2_B) - j * CoefficientsT::PI_2_C;
+			FloatT z = r * r;
+
+			FloatT s = r + r * z * (CoefficientsT::S[0] + z * (CoefficientsT::S[1] + z * CoefficientsT::S[2]));
+			FloatT c = (FloatT(1) - FloatT(0.5) * z) + z * z * (CoefficientsT::C[0] + z * (CoefficientsT::C[1] + z * CoefficientsT::C[2]));
+
+			long quadrant = long(j) & 3;
+
+			if (quadrant & 1)
+				std::swap(s, c);
+
+			sine = (quadrant & 2) ? -s : s;
+			cosine = ((quadrant + 1) & 2) ? -c : c;
+		}
+
+		template <typename FloatT>
+		FloatT fast_sin (FloatT angle)
+		{
+			FloatT sine, cosine;
+			fast_sin_cos(angle, sine, cosine);
+
+			return sine;
+		}
+
+		template <typename FloatT>
+		FloatT fast_cos (FloatT angle)
+		{
+			FloatT sine, cosine;
+			fast_sin_cos(angle, sine, cosine);
+
+			return cosine;
+		}
+
+		template <typename FloatT>
+		FloatT fast_tan (FloatT angle)
+		{
+			FloatT sine, cosine;
+			fast_sin_cos(angle, sine, cosine);
+
+			return sine / cosine;
+		}
+
+		/// The arc cosine, i.e. the angle in [0, pi] whose cosine is x.
+		template <typename FloatT>
+		FloatT fast_acos (FloatT x)
+		{
+			typedef TrigonometryCoefficients<FloatT> CoefficientsT;
+
+			FloatT a = std::min(std::abs(x), FloatT(1));
+
+			// Near the ends of the range, acos(a) = 2 * asin(sqrt((1 - a) / 2)), which keeps the argument of the polynomial small:
+			bool outer = a > FloatT(0.5);
+			FloatT z = outer ? FloatT(0.5) * (FloatT(1) - a) : x * x;
+			FloatT b = outer ? std::sqrt(z) : x;
+
+			FloatT p = ((((CoefficientsT::A[0] * z + CoefficientsT::A[1]) * z + CoefficientsT::A[2]) * z + CoefficientsT::A[3]) * z + CoefficientsT::A[4]);
+			FloatT r = b + b * z * p;
+
+			if (outer)
+				return x < 0 ? CoefficientsT::PI - (r + r) : r + r;
+			else
+				return CoefficientsT::PI_2 - r;
+		}
+
+		/// The angle in [-pi, pi] between the positive x axis and the point (x, y).
+		template <typename FloatT>
+		FloatT fast_atan2 (FloatT y, FloatT x)
+		{
+			typedef TrigonometryCoefficients<FloatT> CoefficientsT;
+
+			FloatT ax = std::abs(x), ay = std::abs(y);
+
+			// Compute the angle in the first octant, which avoids dividing by zero unless both are zero:
+			FloatT t = std::min(ax, ay) / std::max(std::max(ax, ay), std::numeric_limits<FloatT>::min());
+
+			bool reduced = t > CoefficientsT::TAN_PI_8;
+
+			// atan(t) = pi/4 + atan((t - 1) / (t + 1)):
+			if (reduced) t = (t - FloatT(1)) / (t + FloatT(1));
+
+			FloatT z = t * t;
+			FloatT r = (((CoefficientsT::T[0] * z + CoefficientsT::T[1]) * z + CoefficientsT::T[2]) * z + CoefficientsT::T[3]) * z * t + t;
+
+			if (reduced) r = CoefficientsT::PI_4 + r;
+			if (ay > ax) r = CoefficientsT::PI_2 - r;
+			if (x < 0) r = CoefficientsT::PI - r;
+
+			return y < 0 ? -r : r;
+		}
+
+		/// Compute the sine and cosine of an array of angles.
+		template <typename FloatT>
+		void fast_sin_cos (const FloatT * angles, FloatT * sines, FloatT * cosines, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				fast_sin_cos(angles[i], sines[i], cosines[i]);
+		}
+
+		/// Compute the arc cosine of an array of values. The output may be the same array as the input.
+		template <typename FloatT>
+		void fast_acos (const FloatT * values, FloatT * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = fast_acos(values[i]);
+		}
+
+		/// Compute fast_atan2(y[i], x[i]) for arrays of coordinates. The output may be the same array as either input.
+		template <typename FloatT>
+		void fast_atan2 (const FloatT * y, const FloatT * x, FloatT * angles, std::size_t count)
+		{
+			for (std::size_t i = 0; i < count; i += 1)
+				angles[i] = fast_atan2(y[i], x[i]);
+		}
+	}
+}
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+		void fast_sin_cos(const float * angles, float * sines, float * cosines, std::size_t count);
+		void fast_acos(const float * values, float * angles, std::size_t count);
+		void fast_atan2(const float * y, const float * x, float * angles, std::size_t count);
+	}
+}
+
+#endif
+
+#endif
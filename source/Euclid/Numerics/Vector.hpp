@@ -33,41 +33,44 @@ namespace Euclid
 			/// Empty constructor. Value of vector is undefined.
 			Vector () = default;
 
-			Vector (const NumericT & value)
+			constexpr Vector (const NumericT & value) : std::array<NumericT, E>()
 			{
-				this->fill(value);
+				for (dimension i = 0; i < E; ++i)
+					(*this)[i] = value;
 			}
 
-			Vector (const Vector & other) : std::array<NumericT, E>(other)
+			constexpr Vector (const Vector & other) : std::array<NumericT, E>(other)
 			{
 			}
 
 			template <typename... TailT>
-			Vector (const NumericT & head, const TailT... tail) : std::array<NumericT, E>{{head, (NumericT)tail...}}
+			constexpr Vector (const NumericT & head, const TailT... tail) : std::array<NumericT, E>{{head, (NumericT)tail...}}
 			{
 			}
 
 			template <dimension F, typename OtherNumericT>
-			Vector (const Vector<F, OtherNumericT> & other)
+			constexpr Vector (const Vector<F, OtherNumericT> & other) : std::array<NumericT, E>()
 			{
-				auto next = std::copy(other.begin(), other.begin() + std::min(F, E), this->begin());
-				std::fill(next, this->end(), 0);
+				for (dimension i = 0; i < E && i < F; ++i)
+					(*this)[i] = other[i];
 			}
 
 			template <typename OtherNumericT>
-			Vector (const OtherNumericT (&data)[E])
+			constexpr Vector (const OtherNumericT (&data)[E]) : std::array<NumericT, E>()
 			{
-				std::copy(data, data + E, this->begin());
+				for (dimension i = 0; i < E; ++i)
+					(*this)[i] = data[i];
 			}
 
 			template <typename OtherNumericT>
-			Vector (const OtherNumericT * data)
+			constexpr Vector (const OtherNumericT * data) : std::array<NumericT, E>()
 			{
-				std::copy(data, data + E, this->begin());
+				for (dimension i = 0; i < E; ++i)
+					(*this)[i] = data[i];
 			}
 
 			template <dimension _E = E, typename = typename std::enable_if<_E == 1>::type>
-			operator NumericT () const
+			constexpr operator NumericT () const
 			{
 				return (*this)[0];
 			}
@@ -90,9 +93,20 @@ namespace Euclid
 				return true;
 			}
 
+			/// Check each component for equivalence, e.g. to find which components of two results differ.
+			Vector<E, bool> equivalent_components(const Vector<E, NumericT> & other) const
+			{
+				Vector<E, bool> result;
+
+				for (dimension i = 0; i < E; ++i)
+					result[i] = Numerics::equivalent(this->data()[i], other[i]);
+
+				return result;
+			}
+
 			/// Geometric comparison.
 			/// @returns true if all components are numerically lesser than the others.
-			bool less_than (const Vector & other) const
+			constexpr bool less_than (const Vector & other) const
 			{
 				for (dimension i = 0; i < E; ++i)
 					if ((*this)[i] >= other[i])
@@ -103,7 +117,7 @@ namespace Euclid
 
 			/// Geometric comparison.
 			/// @returns true if all components are numerically greater than the others.
-			bool greater_than (const Vector & other) const
+			constexpr bool greater_than (const Vector & other) const
 			{
 				for (dimension i = 0; i < E; ++i)
 					if ((*this)[i] <= other[i])
@@ -114,7 +128,7 @@ namespace Euclid
 
 			/// Geometric comparison.
 			/// @returns true if all components are numerically lesser than or equal to the others.
-			bool less_than_or_equal (const Vector & other) const
+			constexpr bool less_than_or_equal (const Vector & other) const
 			{
 				for (dimension i = 0; i < E; ++i)
 					if ((*this)[i] > other[i])
@@ -125,7 +139,7 @@ namespace Euclid
 			
 			/// Geometric comparison.
 			/// @returns true if all components are numerically greater than or equal to the others.
-			bool greater_than_or_equal (const Vector & other) const
+			constexpr bool greater_than_or_equal (const Vector & other) const
 			{
 				for (dimension i = 0; i < E; ++i)
 					if ((*this)[i] < other[i])
@@ -135,7 +149,7 @@ namespace Euclid
 			}
 
 			/// Calculate the dot product of two vectors.
-			Number<NumericT> dot (const Vector & other) const
+			constexpr Number<NumericT> dot (const Vector & other) const
 			{
 				NumericT result = 0;
 
@@ -148,7 +162,7 @@ namespace Euclid
 
 			/// Return the length of the vector squared.
 			/// This method avoids calculating the square root, therefore is faster when you only need to compare the relative lengths of vectors.
-			Number<NumericT> length_squared () const
+			constexpr Number<NumericT> length_squared () const
 			{
 				return this->dot(*this);
 			}
@@ -168,7 +182,7 @@ namespace Euclid
 			}
 
 			/// Calculate the sum of all components of the vector.
-			Number<NumericT> sum () const
+			constexpr Number<NumericT> sum () const
 			{
 				NumericT result = 0;
 
@@ -179,7 +193,7 @@ namespace Euclid
 			}
 
 			/// Calculate the product of all components of the vector.
-			Number<NumericT> product () const
+			constexpr Number<NumericT> product () const
 			{
 				NumericT result = 1;
 				
@@ -222,7 +236,7 @@ namespace Euclid
 
 			/// Given a size vector (this) and a coordinate, return an index.
 			/// @sa distribute
-			Number<NumericT> index (const Vector & coord) const
+			constexpr Number<NumericT> index (const Vector & coord) const
 			{
 				NumericT idx = 0;
 				NumericT m = 1;
@@ -343,24 +357,24 @@ namespace Euclid
 			}
 
 			/// Calculate the negated vector and return it as a copy.
-			Vector operator- () const
+			constexpr Vector operator- () const
 			{
-				Vector result;
+				Vector result(*this);
 
 				for (std::size_t i = 0; i < E; i += 1) {
-					result[i] = -(*this)[i];
+					result[i] = -result[i];
 				}
 
 				return result;
 			}
 
 			/// Calculate the inverse vector and return it as a copy.
-			Vector operator! () const
+			constexpr Vector operator! () const
 			{
-				Vector result;
+				Vector result(*this);
 
 				for (std::size_t i = 0; i < E; i += 1) {
-					result[i] = !(*this)[i];
+					result[i] = !result[i];
 				}
 
 				return result;
@@ -368,36 +382,31 @@ namespace Euclid
 
 			/// Returns a vector with F components, by default one less than the current size.
 			template <dimension F = E - 1>
-			Vector<F, NumericT> reduce() const
+			constexpr Vector<F, NumericT> reduce() const
 			{
 				static_assert(F <= E, "Cannot reduce size of vector to larger size");
 
-				Vector<F, NumericT> result;
-
-				std::copy(this->begin(), this->begin() + F, result.begin());
-
-				return result;
+				return Vector<F, NumericT>(*this);
 			}
 
 			template <typename... ArgumentsT>
-			Vector<E+sizeof...(ArgumentsT), NumericT> expand(ArgumentsT... arguments) const
+			constexpr Vector<E+sizeof...(ArgumentsT), NumericT> expand(ArgumentsT... arguments) const
 			{
-				Vector<E+sizeof...(ArgumentsT), NumericT> result;
+				Vector<E+sizeof...(ArgumentsT), NumericT> result(*this);
 
-				auto next = std::copy(this->begin(), this->end(), result.begin());
+				const NumericT tail[] = {(NumericT)arguments...};
 
-				NumericT tail[] = {(NumericT)arguments...};
-				std::copy(std::begin(tail), std::end(tail), next);
+				for (std::size_t i = 0; i < sizeof...(ArgumentsT); i += 1)
+					result[E + i] = tail[i];
 
 				return result;
 			}
 
-			Vector<E+1, NumericT> operator<<(const NumericT & tail) const
+			constexpr Vector<E+1, NumericT> operator<<(const NumericT & tail) const
 			{
-				Vector<E+1, NumericT> result;
+				Vector<E+1, NumericT> result(*this);
 
-				auto next = std::copy(this->begin(), this->end(), result.begin());
-				*next = tail;
+				result[E] = tail;
 
 				return result;
 			}
@@ -446,7 +455,7 @@ namespace Euclid
 
 #define EUCLID_NUMERICS_VECTOR_OPERATOR(OP, OPE) \
 	template <dimension E, typename NumericT, typename AnyT> \
-	inline Vector<E, NumericT> operator OP (const Vector<E, NumericT> & lhs, const AnyT & n) \
+	constexpr inline Vector<E, NumericT> operator OP (const Vector<E, NumericT> & lhs, const AnyT & n) \
 	{ \
 		Vector<E, NumericT> tmp(lhs); \
 		return tmp OPE n; \
@@ -466,7 +475,7 @@ namespace Euclid
 
 #define EUCLID_NUMERICS_VECTOR_OPERATOR(OP) \
 	template <dimension E, typename NumericT, typename OtherNumericT> \
-	Vector<E, NumericT> & operator OP (Vector<E, NumericT> & lhs, const Vector<E, OtherNumericT> & n) \
+	constexpr Vector<E, NumericT> & operator OP (Vector<E, NumericT> & lhs, const Vector<E, OtherNumericT> & n) \
 	{ \
 		for (dimension i = 0; i < E; ++i) \
 			lhs[i] OP n[i]; \
@@ -485,7 +494,7 @@ namespace Euclid
 
 #define EUCLID_NUMERICS_VECTOR_OPERATOR(OP) \
 	template <dimension E, typename NumericT, typename OtherNumericT> \
-	Vector<E, NumericT> & operator OP (Vector<E, NumericT> & lhs, const OtherNumericT & n) \
+	constexpr Vector<E, NumericT> & operator OP (Vector<E, NumericT> & lhs, const OtherNumericT & n) \
 	{ \
 		for (dimension i = 0; i < E; ++i) \
 			lhs[i] OP n; \
@@ -514,6 +523,26 @@ namespace Euclid
 			return a.equivalent(b);
 		}
 
+		/// Whether every component of a mask is set, e.g. the result of equivalent_components.
+		template <dimension E>
+		constexpr bool all (const Vector<E, bool> & mask)
+		{
+			for (dimension i = 0; i < E; ++i)
+				if (!mask[i]) return false;
+
+			return true;
+		}
+
+		/// Whether any component of a mask is set.
+		template <dimension E>
+		constexpr bool any (const Vector<E, bool> & mask)
+		{
+			for (dimension i = 0; i < E; ++i)
+				if (mask[i]) return true;
+
+			return false;
+		}
+
 		template <dimension E, typename NumericT>
 		inline constexpr Number<NumericT> number(const Vector<E, NumericT> & vector)
 		{
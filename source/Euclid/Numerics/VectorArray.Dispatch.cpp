@@ -0,0 +1,67 @@
+//
+//  Numerics/VectorArray.Dispatch.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "VectorArray.Dispatch.hpp"
+#include "Kernels.hpp"
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+namespace Euclid {
+	namespace Numerics {
+		namespace Lanes {
+#define EUCLID_NUMERICS_LANES_DISPATCH(NAME, ...) \
+				EUCLID_NUMERICS_KERNELS_CALL(Lanes::NAME(__VA_ARGS__))
+
+#define EUCLID_NUMERICS_LANES_DEFINE(NumericT) \
+			void add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(add, result, a, b, count) \
+			} \
+			void subtract (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(subtract, result, a, b, count) \
+			} \
+			void multiply (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(multiply, result, a, b, count) \
+			} \
+			void divide (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(divide, result, a, b, count) \
+			} \
+			void add (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(add, result, a, b, count) \
+			} \
+			void subtract (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(subtract, result, a, b, count) \
+			} \
+			void multiply (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(multiply, result, a, b, count) \
+			} \
+			void divide (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(divide, result, a, b, count) \
+			} \
+			void multiply_add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(multiply_add, result, a, b, count) \
+			} \
+			void multiply_subtract (NumericT * result, const NumericT * a, const NumericT * b, const NumericT * c, const NumericT * d, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(multiply_subtract, result, a, b, c, d, count) \
+			} \
+			void square_root (NumericT * result, const NumericT * a, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(square_root, result, a, count) \
+			} \
+			void normalize_factor (NumericT * result, const NumericT * length_squared, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(normalize_factor, result, length_squared, count) \
+			} \
+			void clamp (NumericT * result, const NumericT * a, const NumericT & minimum, const NumericT & maximum, std::size_t count) { \
+				EUCLID_NUMERICS_LANES_DISPATCH(clamp, result, a, minimum, maximum, count) \
+			}
+
+			EUCLID_NUMERICS_LANES_DEFINE(float)
+			EUCLID_NUMERICS_LANES_DEFINE(double)
+
+#undef EUCLID_NUMERICS_LANES_DEFINE
+#undef EUCLID_NUMERICS_LANES_DISPATCH
+		}
+	}
+}
+
+#endif
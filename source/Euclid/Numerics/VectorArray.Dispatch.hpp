@@ -0,0 +1,43 @@
+//
+//  Numerics/VectorArray.Dispatch.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_VECTOR_ARRAY_DISPATCH_H
+#define _EUCLID_NUMERICS_VECTOR_ARRAY_DISPATCH_H
+
+#include "Instructions.hpp"
+
+#include <cstddef>
+
+#ifdef EUCLID_NUMERICS_KERNELS
+
+// Declares the optimised lane functions for one numeric type. This is also used to declare the kernels for each instruction set.
+#define EUCLID_NUMERICS_LANES_DECLARE(NumericT) \
+			void add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count); \
+			void subtract (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count); \
+			void multiply (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count); \
+			void divide (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count); \
+			void add (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count); \
+			void subtract (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count); \
+			void multiply (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count); \
+			void divide (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count); \
+			void multiply_add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count); \
+			void multiply_subtract (NumericT * result, const NumericT * a, const NumericT * b, const NumericT * c, const NumericT * d, std::size_t count); \
+			void square_root (NumericT * result, const NumericT * a, std::size_t count); \
+			void normalize_factor (NumericT * result, const NumericT * length_squared, std::size_t count); \
+			void clamp (NumericT * result, const NumericT * a, const NumericT & minimum, const NumericT & maximum, std::size_t count);
+
+namespace Euclid {
+	namespace Numerics {
+		namespace Lanes {
+			// These are optimised specializations which call the best kernels for the selected instructions, see Instructions.hpp:
+			EUCLID_NUMERICS_LANES_DECLARE(float)
+			EUCLID_NUMERICS_LANES_DECLARE(double)
+		}
+	}
+}
+
+#endif
+
+#endif
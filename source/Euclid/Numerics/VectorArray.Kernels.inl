@@ -0,0 +1,141 @@
+//
+//  Numerics/VectorArray.Kernels.inl
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+// The VectorArray lane kernels, written in terms of SIMD.inl. This file has no include guard: it is included by the Kernels.*.cpp files inside the Lanes namespace of each instruction set.
+
+namespace {
+	/// Apply KernelT::step over all lanes using the widest packets available, and finish the remainder one element at a time.
+	template <template <typename> class KernelT, typename NumericT, typename... ArgumentsT>
+	void each (std::size_t count, ArgumentsT... arguments)
+	{
+		std::size_t i = 0;
+
+#if EUCLID_NUMERICS_SIMD_BYTES >= 32
+		typedef Packet<NumericT, 32 / sizeof(NumericT)> WideT;
+
+		for (; i + WideT::WIDTH <= count; i += WideT::WIDTH)
+			KernelT<WideT>::step(i, arguments...);
+#endif
+
+		typedef Packet<NumericT, 16 / sizeof(NumericT)> NarrowT;
+
+		for (; i + NarrowT::WIDTH <= count; i += NarrowT::WIDTH)
+			KernelT<NarrowT>::step(i, arguments...);
+
+		typedef Packet<NumericT, 1> ScalarT;
+
+		for (; i < count; i += 1)
+			KernelT<ScalarT>::step(i, arguments...);
+	}
+
+#define EUCLID_NUMERICS_LANES_BINARY_KERNEL(NAME, OP) \
+	template <typename PacketT> \
+	struct NAME { \
+		template <typename NumericT> \
+		static void step (std::size_t i, NumericT * result, const NumericT * a, const NumericT * b) { \
+			(PacketT::load(a + i) OP PacketT::load(b + i)).store(result + i); \
+		} \
+		template <typename NumericT> \
+		static void step (std::size_t i, NumericT * result, const NumericT * a, NumericT b) { \
+			(PacketT::load(a + i) OP PacketT::broadcast(b)).store(result + i); \
+		} \
+	};
+
+	EUCLID_NUMERICS_LANES_BINARY_KERNEL(AddKernel, +)
+	EUCLID_NUMERICS_LANES_BINARY_KERNEL(SubtractKernel, -)
+	EUCLID_NUMERICS_LANES_BINARY_KERNEL(MultiplyKernel, *)
+	EUCLID_NUMERICS_LANES_BINARY_KERNEL(DivideKernel, /)
+
+#undef EUCLID_NUMERICS_LANES_BINARY_KERNEL
+
+	template <typename PacketT>
+	struct MultiplyAddKernel {
+		template <typename NumericT>
+		static void step (std::size_t i, NumericT * result, const NumericT * a, const NumericT * b) {
+			multiply_add(PacketT::load(a + i), PacketT::load(b + i), PacketT::load(result + i)).store(result + i);
+		}
+	};
+
+	template <typename PacketT>
+	struct MultiplySubtractKernel {
+		template <typename NumericT>
+		static void step (std::size_t i, NumericT * result, const NumericT * a, const NumericT * b, const NumericT * c, const NumericT * d) {
+			(PacketT::load(a + i) * PacketT::load(b + i) - PacketT::load(c + i) * PacketT::load(d + i)).store(result + i);
+		}
+	};
+
+	template <typename PacketT>
+	struct SquareRootKernel {
+		template <typename NumericT>
+		static void step (std::size_t i, NumericT * result, const NumericT * a) {
+			PacketT::load(a + i).square_root().store(result + i);
+		}
+	};
+
+	template <typename PacketT>
+	struct NormalizeFactorKernel {
+		template <typename NumericT>
+		static void step (std::size_t i, NumericT * result, const NumericT * length_squared) {
+			PacketT length = PacketT::load(length_squared + i).square_root();
+			PacketT one = PacketT::broadcast(1);
+
+			length.select_greater(PacketT::broadcast(EpsilonTraits<NumericT, 0>::EPSILON), one / length, one).store(result + i);
+		}
+	};
+
+	template <typename PacketT>
+	struct ClampKernel {
+		template <typename NumericT>
+		static void step (std::size_t i, NumericT * result, const NumericT * a, NumericT minimum, NumericT maximum) {
+			PacketT::load(a + i).maximum(PacketT::broadcast(minimum)).minimum(PacketT::broadcast(maximum)).store(result + i);
+		}
+	};
+}
+
+#define EUCLID_NUMERICS_LANES_DEFINE(NumericT) \
+void add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+	each<AddKernel, NumericT>(count, result, a, b); \
+} \
+void subtract (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+	each<SubtractKernel, NumericT>(count, result, a, b); \
+} \
+void multiply (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+	each<MultiplyKernel, NumericT>(count, result, a, b); \
+} \
+void divide (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+	each<DivideKernel, NumericT>(count, result, a, b); \
+} \
+void add (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+	each<AddKernel, NumericT>(count, result, a, b); \
+} \
+void subtract (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+	each<SubtractKernel, NumericT>(count, result, a, b); \
+} \
+void multiply (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+	each<MultiplyKernel, NumericT>(count, result, a, b); \
+} \
+void divide (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count) { \
+	each<DivideKernel, NumericT>(count, result, a, b); \
+} \
+void multiply_add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count) { \
+	each<MultiplyAddKernel, NumericT>(count, result, a, b); \
+} \
+void multiply_subtract (NumericT * result, const NumericT * a, const NumericT * b, const NumericT * c, const NumericT * d, std::size_t count) { \
+	each<MultiplySubtractKernel, NumericT>(count, result, a, b, c, d); \
+} \
+void square_root (NumericT * result, const NumericT * a, std::size_t count) { \
+	each<SquareRootKernel, NumericT>(count, result, a); \
+} \
+void normalize_factor (NumericT * result, const NumericT * length_squared, std::size_t count) { \
+	each<NormalizeFactorKernel, NumericT>(count, result, length_squared); \
+} \
+void clamp (NumericT * result, const NumericT * a, const NumericT & minimum, const NumericT & maximum, std::size_t count) { \
+	each<ClampKernel, NumericT>(count, result, a, minimum, maximum); \
+}
+
+EUCLID_NUMERICS_LANES_DEFINE(float)
+EUCLID_NUMERICS_LANES_DEFINE(double)
+
+#undef EUCLID_NUMERICS_LANES_DEFINE
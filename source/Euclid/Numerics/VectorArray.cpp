@@ -0,0 +1,16 @@
+//
+//  Numerics/VectorArray.cpp
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#include "VectorArray.hpp"
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		template class VectorArray<2, RealT>;
+		template class VectorArray<3, RealT>;
+		template class VectorArray<4, RealT>;
+	}
+}
@@ -0,0 +1,341 @@
+//
+//  Numerics/VectorArray.h
+//  This file is part of the "Euclid" project, and is released under the MIT license.
+//
+
+#ifndef _EUCLID_NUMERICS_VECTOR_ARRAY_H
+#define _EUCLID_NUMERICS_VECTOR_ARRAY_H
+
+#include "Numerics.hpp"
+#include "Vector.hpp"
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/// Element-wise operations over contiguous lanes of numbers. These are the building blocks of the VectorArray batch operations. The generic implementations are simple loops, optimised specializations are provided for some types.
+		namespace Lanes
+		{
+			template <typename NumericT>
+			void add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] + b[i];
+			}
+
+			template <typename NumericT>
+			void subtract (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] - b[i];
+			}
+
+			template <typename NumericT>
+			void multiply (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] * b[i];
+			}
+
+			template <typename NumericT>
+			void divide (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] / b[i];
+			}
+
+			template <typename NumericT>
+			void add (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] + b;
+			}
+
+			template <typename NumericT>
+			void subtract (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] - b;
+			}
+
+			template <typename NumericT>
+			void multiply (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] * b;
+			}
+
+			template <typename NumericT>
+			void divide (NumericT * result, const NumericT * a, const NumericT & b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = a[i] / b;
+			}
+
+			/// result += a * b
+			template <typename NumericT>
+			void multiply_add (NumericT * result, const NumericT * a, const NumericT * b, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] += a[i] * b[i];
+			}
+
+			/// result = (a * b) - (c * d)
+			template <typename NumericT>
+			void multiply_subtract (NumericT * result, const NumericT * a, const NumericT * b, const NumericT * c, const NumericT * d, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = (a[i] * b[i]) - (c[i] * d[i]);
+			}
+
+			template <typename NumericT>
+			void square_root (NumericT * result, const NumericT * a, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = std::sqrt(a[i]);
+			}
+
+			/// Computes the factor required to normalize a vector given its squared length. Vectors of zero length are left unchanged, consistent with Vector::normalize.
+			template <typename NumericT>
+			void normalize_factor (NumericT * result, const NumericT * length_squared, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1) {
+					NumericT length = std::sqrt(length_squared[i]);
+
+					result[i] = Numerics::equivalent(length, NumericT(0)) ? 1 : 1 / length;
+				}
+			}
+
+			template <typename NumericT>
+			void clamp (NumericT * result, const NumericT * a, const NumericT & minimum, const NumericT & maximum, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; i += 1)
+					result[i] = std::min(std::max(a[i], minimum), maximum);
+			}
+		}
+	}
+}
+
+#include "VectorArray.Dispatch.hpp"
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		/** A structure-of-arrays container of fixed-size vectors.
+
+		Each component is stored in its own contiguous lane, so that batch operations can process many vectors at once using wide SIMD registers. Individual vectors can still be read and written, and the container converts to and from std::vector<Vector<E, NumericT>> so that it can be adopted incrementally.
+		*/
+		template <dimension E, typename NumericT = RealT>
+		class VectorArray {
+		public:
+			static_assert(std::is_arithmetic<NumericT>::value, "VectorArray only supports numeric data-types!");
+
+			typedef Vector<E, NumericT> VectorT;
+			typedef std::vector<NumericT> LaneT;
+
+		protected:
+			std::array<LaneT, E> _lanes;
+
+		public:
+			VectorArray () = default;
+
+			explicit VectorArray (std::size_t size)
+			{
+				resize(size);
+			}
+
+			VectorArray (const std::vector<VectorT> & vectors)
+			{
+				resize(vectors.size());
+
+				for (std::size_t i = 0; i < vectors.size(); i += 1)
+					set(i, vectors[i]);
+			}
+
+			/// The number of vectors in the array.
+			std::size_t size () const { return _lanes[0].size(); }
+
+			bool empty () const { return _lanes[0].empty(); }
+
+			void resize (std::size_t size)
+			{
+				for (auto & lane : _lanes)
+					lane.resize(size);
+			}
+
+			void reserve (std::size_t capacity)
+			{
+				for (auto & lane : _lanes)
+					lane.reserve(capacity);
+			}
+
+			void clear ()
+			{
+				for (auto & lane : _lanes)
+					lane.clear();
+			}
+
+			void push_back (const VectorT & vector)
+			{
+				for (dimension c = 0; c < E; c += 1)
+					_lanes[c].push_back(vector[c]);
+			}
+
+			/// The contiguous storage of a single component, e.g. lane(X).
+			NumericT * lane (dimension c) { return _lanes[c].data(); }
+			const NumericT * lane (dimension c) const { return _lanes[c].data(); }
+
+			/// Gather the components of a single vector.
+			VectorT operator[] (std::size_t i) const
+			{
+				VectorT result;
+
+				for (dimension c = 0; c < E; c += 1)
+					result[c] = _lanes[c][i];
+
+				return result;
+			}
+
+			/// Scatter the components of a single vector.
+			void set (std::size_t i, const VectorT & vector)
+			{
+				for (dimension c = 0; c < E; c += 1)
+					_lanes[c][i] = vector[c];
+			}
+
+			std::vector<VectorT> to_vector () const
+			{
+				std::vector<VectorT> result(size());
+
+				for (std::size_t i = 0; i < result.size(); i += 1)
+					result[i] = (*this)[i];
+
+				return result;
+			}
+
+			operator std::vector<VectorT> () const
+			{
+				return to_vector();
+			}
+		};
+
+		typedef VectorArray<2, RealT> Vec2Array;
+		typedef VectorArray<3, RealT> Vec3Array;
+		typedef VectorArray<4, RealT> Vec4Array;
+
+// MARK: -
+// MARK: Batch Operations
+
+#define EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION(NAME, OPE) \
+		template <dimension E, typename NumericT> \
+		void NAME (VectorArray<E, NumericT> & result, const VectorArray<E, NumericT> & a, const VectorArray<E, NumericT> & b) \
+		{ \
+			assert(a.size() == b.size()); \
+			result.resize(a.size()); \
+			for (dimension c = 0; c < E; c += 1) \
+				Lanes::NAME(result.lane(c), a.lane(c), b.lane(c), a.size()); \
+		} \
+		template <dimension E, typename NumericT, typename ScalarT> \
+		void NAME (VectorArray<E, NumericT> & result, const VectorArray<E, NumericT> & a, const ScalarT & b) \
+		{ \
+			result.resize(a.size()); \
+			for (dimension c = 0; c < E; c += 1) \
+				Lanes::NAME(result.lane(c), a.lane(c), (NumericT)b, a.size()); \
+		} \
+		template <dimension E, typename NumericT, typename OtherT> \
+		VectorArray<E, NumericT> & operator OPE (VectorArray<E, NumericT> & lhs, const OtherT & rhs) \
+		{ \
+			NAME(lhs, lhs, rhs); \
+			return lhs; \
+		}
+
+		EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION(add, +=)
+		EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION(subtract, -=)
+		EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION(multiply, *=)
+		EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION(divide, /=)
+
+#undef EUCLID_NUMERICS_VECTOR_ARRAY_OPERATION
+
+		/// Calculate the dot product of corresponding vectors.
+		template <dimension E, typename NumericT>
+		void dot (VectorArray<1, NumericT> & result, const VectorArray<E, NumericT> & a, const VectorArray<E, NumericT> & b)
+		{
+			assert(a.size() == b.size());
+			result.resize(a.size());
+
+			Lanes::multiply(result.lane(0), a.lane(0), b.lane(0), a.size());
+
+			for (dimension c = 1; c < E; c += 1)
+				Lanes::multiply_add(result.lane(0), a.lane(c), b.lane(c), a.size());
+		}
+
+		/// Calculate the squared length of every vector.
+		template <dimension E, typename NumericT>
+		void length_squared (VectorArray<1, NumericT> & result, const VectorArray<E, NumericT> & a)
+		{
+			dot(result, a, a);
+		}
+
+		/// Calculate the length of every vector.
+		template <dimension E, typename NumericT>
+		void length (VectorArray<1, NumericT> & result, const VectorArray<E, NumericT> & a)
+		{
+			length_squared(result, a);
+
+			Lanes::square_root(result.lane(0), result.lane(0), result.size());
+		}
+
+		/// Normalize every vector to unit length. Vectors of zero length are left unchanged. The result may be the same array as the input.
+		template <dimension E, typename NumericT>
+		void normalize (VectorArray<E, NumericT> & result, const VectorArray<E, NumericT> & a)
+		{
+			VectorArray<1, NumericT> factors;
+
+			length_squared(factors, a);
+			Lanes::normalize_factor(factors.lane(0), factors.lane(0), factors.size());
+
+			result.resize(a.size());
+
+			for (dimension c = 0; c < E; c += 1)
+				Lanes::multiply(result.lane(c), a.lane(c), factors.lane(0), a.size());
+		}
+
+		/// The 3-dimentional cross product of corresponding vectors. The result must not be the same array as either input.
+		template <typename NumericT>
+		void cross_product (VectorArray<3, NumericT> & result, const VectorArray<3, NumericT> & u, const VectorArray<3, NumericT> & v)
+		{
+			assert(u.size() == v.size());
+			assert(&result != &u && &result != &v);
+
+			std::size_t count = u.size();
+			result.resize(count);
+
+			Lanes::multiply_subtract(result.lane(X), u.lane(Y), v.lane(Z), u.lane(Z), v.lane(Y), count);
+			Lanes::multiply_subtract(result.lane(Y), u.lane(Z), v.lane(X), u.lane(X), v.lane(Z), count);
+			Lanes::multiply_subtract(result.lane(Z), u.lane(X), v.lane(Y), u.lane(Y), v.lane(X), count);
+		}
+
+		/// Clamp all components of every vector between the given values.
+		template <dimension E, typename NumericT>
+		void clamp (VectorArray<E, NumericT> & result, const VectorArray<E, NumericT> & a, const NumericT & minimum = 0, const NumericT & maximum = 1)
+		{
+			result.resize(a.size());
+
+			for (dimension c = 0; c < E; c += 1)
+				Lanes::clamp(result.lane(c), a.lane(c), minimum, maximum, a.size());
+		}
+
+// MARK: -
+
+		extern template class VectorArray<2, RealT>;
+		extern template class VectorArray<3, RealT>;
+		extern template class VectorArray<4, RealT>;
+	}
+}
+
+#endif
@@ -33,7 +33,7 @@ define_target 'euclid-library' do |target|
 	target.depends "Build/Clang"
 	
 	target.depends :platform
-	target.depends "Language/C++11", private: true
+	target.depends "Language/C++17", private: true
 	
 	target.provides "Library/Euclid" do
 		append linkflags [
@@ -52,7 +52,7 @@ define_target "euclid-tests" do |target|
 	target.depends "Build/Clang"
 	
 	target.depends :platform
-	target.depends "Language/C++11", private: true
+	target.depends "Language/C++17", private: true
 	target.depends "Library/UnitTest"
 	target.depends "Library/Euclid"
 	
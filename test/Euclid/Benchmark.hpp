@@ -0,0 +1,36 @@
+#ifndef _EUCLID_TEST_BENCHMARK_H
+#define _EUCLID_TEST_BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <ratio>
+
+namespace Euclid
+{
+	// Timing for the performance test cases, which report their results through the examiner:
+	namespace Benchmark
+	{
+		// The time taken to call the function the given number of times, in units of PeriodT, e.g. std::milli for milliseconds:
+		template <typename PeriodT = std::nano, typename FunctionT>
+		double duration (FunctionT && function, std::size_t passes = 1)
+		{
+			auto start = std::chrono::steady_clock::now();
+
+			for (std::size_t pass = 0; pass < passes; pass += 1)
+				function();
+
+			std::chrono::duration<double, PeriodT> duration = std::chrono::steady_clock::now() - start;
+
+			return duration.count();
+		}
+
+		// The average time in nanoseconds for each item, when every pass of the function processes count items:
+		template <typename FunctionT>
+		double nanoseconds_per_item (std::size_t count, std::size_t passes, FunctionT && function)
+		{
+			return duration(function, passes) / (count * passes);
+		}
+	}
+}
+
+#endif
@@ -4,10 +4,25 @@
 #include <Euclid/Geometry/AlignedTree.hpp>
 #include <Euclid/Numerics/Vector.IO.hpp>
 
+#include "../Benchmark.hpp"
+#include "../Objects.hpp"
+
+#include <iterator>
+#include <random>
+
 namespace Euclid
 {
 	namespace Geometry
 	{
+		namespace
+		{
+			template <typename ObjectSetT>
+			bool contains (const ObjectSetT & objects, const Object & object)
+			{
+				return std::find(objects.begin(), objects.end(), object) != objects.end();
+			}
+		}
+
 		UnitTest::Suite AlignedTreeTestSuite {
 			"Euclid::Geometry::AlignedTree",
 
@@ -29,6 +44,365 @@ namespace Euclid
 					examiner.check_equal(tree.top()->child(Quadrants::TopRight)->objects().size(), 10);
 					examiner.check_equal(tree.top()->child(Quadrants::BottomRight)->objects().size(), 0);
 					examiner.check_equal(tree.top()->child(Quadrants::TopLeft)->objects().size(), 0);
+
+					examiner << "The children have the correct position and size.";
+					auto top_right = tree.top()->child(Quadrants::TopRight);
+					examiner.check_equal(top_right->origin(), Vec2{10, 10});
+					examiner.check_equal(top_right->size(), Vec2{10, 10});
+					examiner.check_equal(top_right->level(), 1);
+					examiner.check_equal(top_right->location(), Quadrants::TopRight);
+					examiner.check_equal(top_right->parent(), tree.top());
+					examiner.check_equal(tree.partition_count(), 5);
+				}
+			},
+
+			{"Contiguous Storage",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(20000, 256);
+
+					AlignedTree<Octants, Object> ordered(0, 256);
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> contiguous(0, 256);
+
+					ordered.insert(objects.begin(), objects.end());
+					contiguous.insert(objects.begin(), objects.end());
+
+					examiner << "Both storage policies partition the objects in the same way.";
+					examiner.check_equal(contiguous.partition_count(), ordered.partition_count());
+
+					for (std::size_t i = 0; i < objects.size(); i += 997)
+						examiner.check_equal(contiguous.find(objects[i])->bounding_box(), ordered.find(objects[i])->bounding_box());
+
+					AlignedBox3 region(Vec3{40, 40, 40}, Vec3{100, 120, 80});
+					auto expected = sorted(ordered.top()->objects_in_rect(region));
+
+					examiner << "Both storage policies find the same objects.";
+					examiner.check(expected.size() > 0);
+					examiner.check(sorted(contiguous.top()->objects_in_rect(region)) == expected);
+
+					examiner << "Objects can be erased.";
+					for (auto & object : expected) {
+						contiguous.erase(object);
+						ordered.erase(object);
+					}
+
+					examiner.check(contiguous.top()->objects_in_rect(region).empty());
+					examiner.check(ordered.top()->objects_in_rect(region).empty());
+				}
+			},
+
+			{"Queries",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(20000, 256);
+
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> tree(0, 256);
+					tree.insert(objects.begin(), objects.end());
+
+					AlignedBox3 region(Vec3{40, 40, 40}, Vec3{100, 120, 80});
+
+					std::vector<Object> expected;
+					for (auto & object : objects)
+						if (object.box.intersects_with(region)) expected.push_back(object);
+
+					examiner << "The objects in a rectangle are visited once each.";
+					std::vector<Object> visited;
+					examiner.check(tree.top()->visit_objects_in_rect(region, [&](const Object & object) {visited.push_back(object);}));
+					examiner.check(sorted(visited) == expected);
+
+					examiner << "The objects in a rectangle are copied to an output iterator.";
+					std::vector<Object> copied;
+					tree.top()->objects_in_rect(region, std::back_inserter(copied));
+					examiner.check(sorted(copied) == expected);
+					examiner.check(sorted(tree.top()->objects_in_rect(region)) == expected);
+
+					examiner << "The query stops when the callback returns false.";
+					std::size_t count = 0;
+					examiner.check(!tree.top()->visit_objects_in_rect(region, [&](const Object &) {return ++count < 10;}));
+					examiner.check_equal(count, 10);
+
+					LineSegment3 line(Vec3{1, 2, 3}, Vec3{250, 200, 150});
+					RealT t1, t2;
+
+					std::vector<Object> crossed;
+					for (auto & object : objects)
+						if (line.intersects_with(object.box, t1, t2)) crossed.push_back(object);
+
+					examiner << "The objects along a line are visited.";
+					examiner.check(crossed.size() > 0);
+					examiner.check(sorted(tree.top()->objects_along_line(line)) == crossed);
+
+					examiner << "The objects in a partition and its parents are visited.";
+					auto partition = tree.find(objects[0]);
+					std::size_t above = 0;
+					for (auto cur = partition; cur; cur = cur->parent())
+						above += cur->objects().size();
+					examiner.check_equal(tree.top()->all_objects().size(), tree.top()->objects().size());
+					examiner.check_equal(partition->all_objects().size(), above);
+				}
+			},
+
+			{"Loose Bounds",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(20000, 256, 16);
+
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> strict(0, 256);
+					AlignedTree<Loose<Octants>, Object, ContiguousStorage<Object>> loose(0, 256);
+
+					strict.insert(objects.begin(), objects.end());
+					loose.insert(objects.begin(), objects.end());
+
+					std::size_t strict_near_top = 0, loose_near_top = 0;
+					bool placed = true;
+
+					for (auto & object : objects) {
+						if (strict.find(object)->level() <= 1) strict_near_top += 1;
+
+						auto partition = loose.find(object);
+						if (partition->level() <= 1) loose_near_top += 1;
+
+						// The object is in the partition's bounds, and is too large for the bounds of its children, if it has any:
+						placed = placed && partition->loose_bounding_box().contains_box(object.box);
+
+						if (partition->child(0)) {
+							RealT child_size = partition->child(0)->size()[X];
+							Vec3 size = object.box.size();
+
+							placed = placed && std::max({size[X], size[Y], size[Z]}) > child_size * (Loose<Octants>::LOOSENESS - 1);
+						}
+					}
+
+					examiner << "Objects near the top: " << strict_near_top << " in the strict tree, " << loose_near_top << " in the loose tree." << std::endl;
+					examiner.check(placed);
+					examiner.check(loose_near_top * 10 < strict_near_top);
+
+					AlignedBox3 region(Vec3{40, 40, 40}, Vec3{100, 120, 80});
+
+					std::vector<Object> expected;
+					for (auto & object : objects)
+						if (object.box.intersects_with(region)) expected.push_back(object);
+
+					examiner << "The loose tree finds the objects in a rectangle.";
+					examiner.check(sorted(loose.top()->objects_in_rect(region)) == expected);
+
+					LineSegment3 line(Vec3{1, 2, 3}, Vec3{250, 200, 150});
+					RealT t1, t2;
+
+					std::vector<Object> crossed;
+					for (auto & object : objects)
+						if (line.intersects_with(object.box, t1, t2)) crossed.push_back(object);
+
+					examiner << "The loose tree finds the objects along a line.";
+					examiner.check(sorted(loose.top()->objects_along_line(line)) == crossed);
+
+					examiner << "Objects can be erased from the loose tree.";
+					for (auto & object : expected)
+						loose.erase(object);
+
+					examiner.check(loose.top()->objects_in_rect(region).empty());
+				}
+			},
+
+			{"Coalescing",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(5000, 256);
+					AlignedTree<Octants, Object> tree(0, 256);
+
+					tree.insert(objects.begin(), objects.end());
+					std::size_t partitions = tree.partition_count();
+
+					examiner << "The tree has been subdivided.";
+					examiner.check(partitions > 1);
+					examiner.check_equal(tree.top()->total_objects(), objects.size());
+
+					for (std::size_t i = 100; i < objects.size(); i += 1)
+						tree.erase(objects[i]);
+
+					examiner << "Erasing most objects coalesces the tree.";
+					examiner.check(tree.partition_count() < partitions);
+					examiner.check_equal(tree.top()->total_objects(), 100);
+
+					std::vector<Object> remaining(objects.begin(), objects.begin() + 100);
+					examiner.check(sorted(tree.top()->objects_in_rect(tree.top()->bounding_box())) == remaining);
+
+					for (std::size_t i = 4; i < 100; i += 1)
+						tree.erase(objects[i]);
+
+					examiner << "The remaining objects are all in the top partition.";
+					examiner.check_equal(tree.partition_count(), 1);
+					examiner.check_equal(tree.top()->objects().size(), 4);
+
+					examiner << "Reinserting the objects subdivides the tree again.";
+					tree.insert(objects.begin(), objects.end());
+					examiner.check(tree.partition_count() > 1);
+					examiner.check_equal(tree.top()->total_objects(), objects.size());
+					examiner.check(sorted(tree.top()->objects_in_rect(tree.top()->bounding_box())) == sorted(objects));
+
+					// A cluster of objects which is just large enough to be split:
+					AlignedTree<Octants, Object> small(0, 256);
+					std::vector<Object> cluster;
+
+					for (std::size_t i = 0; i <= Octants::R; i += 1) {
+						Vec3 min(i * 10 + 1, 1, 1);
+						cluster.push_back({i, AlignedBox3(min, min + 1)});
+					}
+
+					small.insert(cluster.begin(), cluster.end());
+					partitions = small.partition_count();
+					examiner.check(partitions > 1);
+
+					examiner << "Erasing a few objects doesn't coalesce the tree.";
+					std::size_t i = 0;
+					for (; cluster.size() - i > AlignedTree<Octants, Object>::COALESCE_THRESHOLD + 1; i += 1)
+						small.erase(cluster[i]);
+					examiner.check_equal(small.partition_count(), partitions);
+
+					examiner << "Erasing down to the threshold coalesces the tree.";
+					small.erase(cluster[i]);
+					examiner.check_equal(small.partition_count(), 1);
+					examiner.check_equal(small.top()->objects().size(), AlignedTree<Octants, Object>::COALESCE_THRESHOLD);
+
+					examiner << "Erasing with coalesce disabled leaves the partitions.";
+					small.insert(cluster.begin(), cluster.end());
+					partitions = small.partition_count();
+					for (auto & object : cluster)
+						small.erase(object, false);
+					examiner.check_equal(small.partition_count(), partitions);
+					examiner.check_equal(small.top()->total_objects(), 0);
+				}
+			},
+
+			{"Expansion",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(1000, 16);
+					AlignedTree<Octants, Object> tree(0, 16);
+
+					tree.insert(objects.begin(), objects.end());
+
+					examiner << "Inserting an object beyond the positive edge expands the tree.";
+					Object outside{objects.size(), AlignedBox3(Vec3{20, 1, 1}, Vec3{21, 2, 2})};
+					objects.push_back(outside);
+					examiner.check(tree.insert(outside) != NULL);
+					examiner.check_equal(tree.top()->origin(), Vec3{0, 0, 0});
+					examiner.check_equal(tree.top()->size(), Vec3{32, 32, 32});
+
+					examiner << "Inserting an object beyond the negative edge expands the tree.";
+					Object behind{objects.size(), AlignedBox3(Vec3{-40, 1, 1}, Vec3{-39, 2, 2})};
+					objects.push_back(behind);
+					examiner.check(tree.insert(behind) != NULL);
+					examiner.check_equal(tree.top()->origin(), Vec3{-96, 0, 0});
+					examiner.check_equal(tree.top()->size(), Vec3{128, 128, 128});
+
+					examiner << "The existing partitions are moved down into the expanded tree.";
+					examiner.check_equal(tree.top()->total_objects(), objects.size());
+					examiner.check(sorted(tree.top()->objects_in_rect(tree.top()->bounding_box())) == sorted(objects));
+
+					bool found = true;
+					for (auto & object : objects) {
+						auto partition = tree.find(object);
+						found = found && partition && partition->bounding_box().contains_box(object.box) && contains(partition->objects(), object);
+					}
+					examiner.check(found);
+
+					examiner << "The tree isn't expanded if expanding is disabled.";
+					tree.set_expanding(false);
+					examiner.check(tree.insert(Object{objects.size(), AlignedBox3(Vec3{200, 1, 1}, Vec3{201, 2, 2})}) == NULL);
+					examiner.check_equal(tree.top()->size(), Vec3{128, 128, 128});
+
+					examiner << "A loose object whose center is outside the tree is found after expanding.";
+					AlignedTree<Loose<Octants>, Object> loose(0, 32);
+					Object straddling{0, AlignedBox3(Vec3{-1.25, 4, 4}, Vec3{-0.75, 4.5, 4.5})}, beyond{1, AlignedBox3(Vec3{60, 4, 4}, Vec3{61, 5, 5})};
+
+					examiner.check(loose.insert(straddling) != NULL);
+					examiner.check(loose.insert(beyond) != NULL);
+					examiner.check(contains(loose.find(straddling)->objects(), straddling));
+
+					loose.erase(straddling);
+					examiner.check_equal(loose.top()->total_objects(), 1);
+
+					examiner << "Every object can be erased from an expanding loose tree.";
+					std::mt19937 rng(7);
+					std::uniform_real_distribution<RealT> position(-64, 64), size(0.1, 4);
+					std::vector<Object> scattered;
+
+					for (std::size_t i = 2; i < 2000; i += 1) {
+						Vec3 min(position(rng), position(rng), position(rng));
+						scattered.push_back({i, AlignedBox3(min, min + Vec3(size(rng), size(rng), size(rng)))});
+
+						loose.insert(scattered.back());
+
+						// Erase some of the objects as they are inserted:
+						if (i % 3 == 0) {
+							loose.erase(scattered[i / 3]);
+						}
+					}
+
+					loose.erase(beyond);
+					for (auto & object : scattered)
+						loose.erase(object);
+
+					examiner.check_equal(loose.top()->total_objects(), 0);
+					examiner.check(loose.top()->objects_in_rect(loose.top()->loose_bounding_box()).empty());
+				}
+			},
+
+			{"Performance",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(200000, 1024);
+					AlignedBox3 region(Vec3{100, 100, 100}, Vec3{300, 300, 300});
+
+					auto measure = [&](auto & tree) {
+						double inserting = Benchmark::nanoseconds_per_item(objects.size(), 1, [&]{tree.insert(objects.begin(), objects.end());});
+
+						std::size_t found = 0, visited = 0;
+
+						double querying = Benchmark::duration<std::milli>([&]{
+							found += tree.top()->objects_in_rect(region).size();
+						}, 20);
+
+						double visiting = Benchmark::duration<std::milli>([&]{
+							tree.top()->visit_objects_in_rect(region, [&](const Object &) {visited += 1;});
+						}, 20);
+
+						examiner << "Inserting took " << inserting << "ns per object, querying took " << querying / 20 << "ms and visiting took " << visiting / 20 << "ms for " << found / 20 << " objects." << std::endl;
+						examiner.check_equal(visited, found);
+
+						return found;
+					};
+
+					AlignedTree<Octants, Object> ordered(0, 1024);
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> contiguous(0, 1024);
+
+					examiner << "Using OrderedStorage:" << std::endl;
+					auto ordered_found = measure(ordered);
+
+					examiner << "Using ContiguousStorage:" << std::endl;
+					examiner.check_equal(measure(contiguous), ordered_found);
+
+					// A crowd of larger objects, many of which straddle the planes between partitions:
+					auto crowd = random_objects(200000, 256, 8);
+					AlignedBox3 crowd_region(Vec3{100, 100, 100}, Vec3{120, 120, 120});
+
+					auto measure_crowd = [&](auto & tree) {
+						tree.insert(crowd.begin(), crowd.end());
+
+						std::size_t found = 0;
+
+						double visiting = Benchmark::duration<std::micro>([&]{
+							tree.top()->visit_objects_in_rect(crowd_region, [&](const Object &) {found += 1;});
+						}, 1000);
+
+						examiner << "Visiting a small region took " << visiting / 1000 << "us for " << found / 1000 << " objects." << std::endl;
+
+						return found;
+					};
+
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> strict(0, 256);
+					AlignedTree<Loose<Octants>, Object, ContiguousStorage<Object>> loose(0, 256);
+
+					examiner << "Using Octants:" << std::endl;
+					auto strict_found = measure_crowd(strict);
+
+					examiner << "Using Loose<Octants>:" << std::endl;
+					examiner.check_equal(measure_crowd(loose), strict_found);
 				}
 			},
 		};
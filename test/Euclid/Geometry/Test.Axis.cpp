@@ -77,6 +77,23 @@ namespace Euclid
 					examiner.check(p4.equivalent({-6, -4, -4}));
 				}
 			},
+
+			{"Dual Quaternion",
+				[](UnitTest::Examiner & examiner) {
+					auto a1 = Axis<RealT>{{1, 2, 3}, rotate<Z>(R90)};
+					DualQuat d1 = a1;
+
+					examiner << "Dual quaternion transforms points from origin-space to axis-space." << std::endl;
+					examiner.check((d1 * Vec3(0)).equivalent({1, 2, 3}));
+					examiner.check((d1 * Vec3(1, 0, 0)).equivalent(a1.from_origin() * Vec3(1, 0, 0)));
+
+					Axis<RealT> a2 = d1;
+
+					examiner << "Axis can be converted back from a dual quaternion." << std::endl;
+					examiner.check(a2.translation().equivalent({1, 2, 3}));
+					examiner.check(a2.rotation().equivalent(a1.rotation()));
+				}
+			},
 		};
 	}
 }
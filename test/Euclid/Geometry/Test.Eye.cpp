@@ -42,6 +42,10 @@ namespace Euclid
 
 					examiner << "Looking along z axis." << std::endl;
 					examiner.expect(object_space.forward.direction()) == Vec3{0, 0, 1};
+
+					examiner << "The affine view matrix gives the same transformation." << std::endl;
+					auto affine_eye = affine_eye_transformation<RealT>(orthographic_projection_matrix(box), translate(Vec3(10, 10, 0)));
+					examiner.check(affine_eye.inverse_view_matrix.equivalent(eye.inverse_view_matrix));
 				}
 			},
 			
@@ -0,0 +1,143 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Geometry/LinearTree.hpp>
+
+#include "../Benchmark.hpp"
+#include "../Objects.hpp"
+
+#include <random>
+#include <thread>
+
+namespace Euclid
+{
+	namespace Geometry
+	{
+		UnitTest::Suite LinearTreeTestSuite {
+			"Euclid::Geometry::LinearTree",
+
+			{"Morton Codes",
+				[](UnitTest::Examiner & examiner) {
+					examiner << "The bits of the coordinates are interleaved in the order of the partition indices.";
+					examiner.check_equal(morton_code<2>({1, 0}), Quadrants::BottomRight);
+					examiner.check_equal(morton_code<2>({0, 1}), Quadrants::TopLeft);
+					examiner.check_equal(morton_code<3>({0, 0, 1}), Octants::BottomLeftFar);
+					examiner.check_equal(morton_code<3>({3, 5, 6}), 0b110101011);
+					examiner.check_equal(morton_code<3>({0x1FFFFF, 0x1FFFFF, 0x1FFFFF}), (std::uint64_t(1) << 63) - 1);
+
+					std::mt19937 rng(1);
+					std::vector<MortonEntry> entries(100000);
+
+					for (std::size_t i = 0; i < entries.size(); i += 1)
+						entries[i] = {rng() % 1000 + (std::uint64_t(rng()) << 40), std::uint32_t(i)};
+
+					auto expected = entries;
+					std::stable_sort(expected.begin(), expected.end(), [](const MortonEntry & a, const MortonEntry & b) {return a.code < b.code;});
+
+					sort_morton_entries(entries, 4);
+
+					examiner << "The radix sort is stable.";
+					bool same = true;
+					for (std::size_t i = 0; i < entries.size(); i += 1)
+						same = same && entries[i].code == expected[i].code && entries[i].index == expected[i].index;
+					examiner.check(same);
+				}
+			},
+
+			{"Queries",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(50000, 256, 8);
+
+					LinearTree<Octants, Object> tree(objects.begin(), objects.end(), 4);
+
+					examiner << "Every object is in the tree.";
+					examiner.check_equal(tree.objects().size(), objects.size());
+					examiner.check_equal(tree.nodes().front().begin, 0);
+					examiner.check_equal(tree.nodes().front().end, objects.size());
+					examiner.check_equal(tree.nodes().front().skip, tree.nodes().size());
+
+					examiner << "The leaves are small, and contain the objects' bounds.";
+					bool small = true, bounded = true;
+					for (auto & node : tree.nodes()) {
+						if (tree.is_leaf(node))
+							small = small && node.end - node.begin <= Octants::R;
+
+						for (std::size_t i = node.begin; i < node.end; i += 1)
+							bounded = bounded && node.bounds.contains_box(tree.objects()[i].box);
+					}
+					examiner.check(small);
+					examiner.check(bounded);
+
+					AlignedBox3 region(Vec3{40, 40, 40}, Vec3{100, 120, 80});
+
+					std::vector<Object> expected;
+					for (auto & object : objects)
+						if (object.box.intersects_with(region)) expected.push_back(object);
+
+					examiner << "The objects in a rectangle are found.";
+					examiner.check(expected.size() > 0);
+					examiner.check(sorted(tree.objects_in_rect(region)) == expected);
+
+					LineSegment3 line(Vec3{1, 2, 3}, Vec3{250, 200, 150});
+					RealT t1, t2;
+
+					std::vector<Object> crossed;
+					for (auto & object : objects)
+						if (line.intersects_with(object.box, t1, t2)) crossed.push_back(object);
+
+					examiner << "The objects along a line are found.";
+					examiner.check(crossed.size() > 0);
+					examiner.check(sorted(tree.objects_along_line(line)) == crossed);
+
+					examiner << "The query stops when the callback returns false.";
+					std::size_t count = 0;
+					examiner.check(!tree.visit_objects_in_rect(region, [&](const Object &) {return ++count < 10;}));
+					examiner.check_equal(count, 10);
+
+					examiner << "The tree is the same for any number of threads.";
+					LinearTree<Octants, Object> serial(objects.begin(), objects.end(), 1);
+					examiner.check(serial.objects() == tree.objects());
+					examiner.check_equal(serial.nodes().size(), tree.nodes().size());
+
+					examiner << "Objects with the same center are kept together.";
+					std::vector<Object> stacked(100, objects[0]);
+					for (std::size_t i = 0; i < stacked.size(); i += 1)
+						stacked[i].identity = i;
+					LinearTree<Octants, Object> stack(stacked.begin(), stacked.end());
+					examiner.check_equal(stack.nodes().size(), 1);
+					examiner.check_equal(stack.objects_in_rect(objects[0].box).size(), 100);
+				}
+			},
+
+			{"Performance",
+				[](UnitTest::Examiner & examiner) {
+					auto objects = random_objects(1000000, 1024, 4);
+
+					LinearTree<Octants, Object> linear;
+					AlignedTree<Octants, Object, ContiguousStorage<Object>> aligned(0, 1024);
+
+					double inserting = Benchmark::duration<std::milli>([&]{aligned.insert(objects.begin(), objects.end());});
+					double serial = Benchmark::duration<std::milli>([&]{linear.build(objects.begin(), objects.end(), 1);});
+					double parallel = Benchmark::duration<std::milli>([&]{linear.build(objects.begin(), objects.end());});
+
+					examiner << "Inserting " << objects.size() << " objects took " << inserting << "ms, building a linear tree took " << serial << "ms on one thread and " << parallel << "ms on " << std::thread::hardware_concurrency() << " threads." << std::endl;
+
+					AlignedBox3 region(Vec3{100, 100, 100}, Vec3{200, 200, 200});
+					std::size_t linear_found = 0, aligned_found = 0;
+
+					double linear_query = Benchmark::duration<std::milli>([&]{
+						for (std::size_t i = 0; i < 20; i += 1)
+							linear.visit_objects_in_rect(region, [&](const Object &) {linear_found += 1;});
+					});
+
+					double aligned_query = Benchmark::duration<std::milli>([&]{
+						for (std::size_t i = 0; i < 20; i += 1)
+							aligned.top()->visit_objects_in_rect(region, [&](const Object &) {aligned_found += 1;});
+					});
+
+					examiner << "Visiting a region took " << linear_query / 20 << "ms in the linear tree and " << aligned_query / 20 << "ms in the aligned tree for " << linear_found / 20 << " objects." << std::endl;
+					examiner.check_equal(linear_found, aligned_found);
+				}
+			},
+		};
+	}
+}
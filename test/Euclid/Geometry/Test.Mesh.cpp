@@ -4,6 +4,8 @@
 #include <Euclid/Geometry/Mesh.hpp>
 #include <Euclid/Geometry/Generate/Cube.hpp>
 
+#include <vector>
+
 namespace Euclid
 {
 	namespace Geometry
@@ -33,6 +35,54 @@ namespace Euclid
 					examiner.check_equal(sizeof(RealT) * 8, sizeof(VertexP3N3M2));
 				}
 			},
+
+			{"Skinning",
+				[](UnitTest::Examiner & examiner) {
+					Mesh<> mesh;
+
+					for (std::size_t i = 0; i < 10003; i += 1)
+						mesh << VertexP3N3M2{{RealT(i % 17), RealT(i % 13) - 6, RealT(i % 5)}, Vec3(1, RealT(i % 3), -1).normalize(), {0, 0}};
+
+					DualQuat palette[3] = {
+						{Vec3(1, 2, 3), rotate<Z>(R90)},
+						{Vec3(-4, 0, 1), rotate<X>(R30)},
+						// The same rotation as the first bone, but in the opposite hemisphere:
+						{Vec3(1, 2, 3), Quat(-Vec4(Quat(rotate<Z>(R90))))},
+					};
+
+					std::vector<BoneInfluences> influences;
+					for (std::size_t i = 0; i < mesh.vertices.size(); i += 1) {
+						RealT weight = RealT(i % 11) / 10;
+						influences.push_back({{std::uint16_t(i % 2), std::uint16_t(1 - i % 2), 2, 0}, {weight, 1 - weight, 0, 0}});
+					}
+
+					// A vertex which is completely influenced by two bones representing the same transform:
+					influences[0] = {{0, 2, 0, 0}, {0.5, 0.5, 0, 0}};
+
+					std::vector<Vec3> positions(mesh.vertices.size()), normals(mesh.vertices.size());
+					skin(mesh, palette, influences.data(), positions.data(), normals.data(), 1);
+
+					// The blended transform is normalized, so it only matches to within a few ULP:
+					auto nearby = [](const Vec3 & a, const Vec3 & b) {
+						return (a - b).length() < 1e-5;
+					};
+
+					examiner << "Bones in opposite hemispheres are blended correctly." << std::endl;
+					examiner.check(nearby(positions[0], palette[0] * mesh.vertices[0].position));
+
+					examiner << "Vertices with a single influence are rigidly transformed." << std::endl;
+					examiner.check(nearby(positions[10], palette[0] * mesh.vertices[10].position));
+					examiner.check(nearby(normals[10], palette[0].transform_vector(mesh.vertices[10].normal)));
+					examiner.check(nearby(positions[21], palette[1] * mesh.vertices[21].position));
+
+					std::vector<Vec3> threaded_positions(mesh.vertices.size()), threaded_normals(mesh.vertices.size());
+					skin(mesh, palette, influences.data(), threaded_positions.data(), threaded_normals.data(), 4);
+
+					examiner << "Skinning on several threads gives the same result." << std::endl;
+					examiner.check(threaded_positions == positions);
+					examiner.check(threaded_normals == normals);
+				}
+			},
 		};
 	}
 }
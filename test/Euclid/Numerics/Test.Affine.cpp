@@ -0,0 +1,113 @@
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Affine.hpp>
+#include <Euclid/Numerics/Matrix.Inverse.hpp>
+#include <Euclid/Geometry/Axis.hpp>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		UnitTest::Suite AffineTestSuite {
+			"Euclid::Numerics::Affine",
+
+			{"Conversion",
+				[](UnitTest::Examiner & examiner) {
+					Mat44 m = rotate<Y>(R30) << translate(vector<RealT>(1, 2, 3)) << scale(vector<RealT>(2, 3, 4));
+					Affine<> a = rotate<Y>(R30) << translate(vector<RealT>(1, 2, 3)) << scale(vector<RealT>(2, 3, 4));
+
+					examiner << "Affine transform is smaller than a 4x4 matrix." << std::endl;
+					examiner.check(sizeof(Affine<>) * 4 == sizeof(Mat44) * 3);
+
+					examiner << "Transform chain matches 4x4 matrix." << std::endl;
+					examiner.check(Mat44(a).equivalent(m));
+					examiner.check(Affine<>(m).equivalent(a));
+
+					Quat q = rotate(R45, vector<RealT>(1, 1, 0).normalize());
+					Affine<> b = q;
+
+					examiner << "Rotation converts to and from quaternion." << std::endl;
+					examiner.check(Mat44(b).equivalent(Mat44(q)));
+					examiner.check(b.rotation().equivalent(q));
+
+					Geometry::Axis<RealT> axis({1, 2, 3}, q);
+					Affine<> c = axis;
+
+					examiner << "Axis converts to and from affine transform." << std::endl;
+					examiner.check(Mat44(c).equivalent(axis.from_origin()));
+					examiner.check(Geometry::Axis<RealT>(c).translation().equivalent({1, 2, 3}));
+					examiner.check(Geometry::Axis<RealT>(c).rotation().equivalent(q));
+				}
+			},
+
+			{"Composition",
+				[](UnitTest::Examiner & examiner) {
+					Affine<float> a = rotate<Z>(R60) << translate(vector(1.0f, -2.0f, 0.5f)) << scale(2.0f);
+					Affine<float> b = rotate(R45, vector(0.0f, 1.0f, 0.0f)) << scale(vector(1.0f, 2.0f, 3.0f)) << translate(vector(4.0f, 5.0f, 6.0f));
+
+					examiner << "Single precision composition matches 4x4 multiplication." << std::endl;
+					examiner.check(Mat44(a * b).equivalent(Mat44(a) * Mat44(b)));
+
+					Affine<double> c = rotate<X>(R30) << translate(vector(1.0, 2.0, 3.0));
+					Affine<double> d = rotate<Y>(R90) << scale(vector(2.0, 1.0, 0.5));
+
+					examiner << "Double precision composition matches 4x4 multiplication." << std::endl;
+					examiner.check(Matrix<4, 4, double>(c * d).equivalent(Matrix<4, 4, double>(c) * Matrix<4, 4, double>(d)));
+
+					examiner << "Composition works in place." << std::endl;
+					Affine<float> e = a;
+					e *= b;
+					examiner.check(e.equivalent(a * b));
+
+					examiner << "Affine transforms compose with other transforms." << std::endl;
+					Affine<float> f = a << b << rotate<X>(R90);
+					examiner.check(Mat44(f).equivalent(Mat44(a) * Mat44(b) * Mat44(rotate<X>(R90))));
+				}
+			},
+
+			{"Inverse",
+				[](UnitTest::Examiner & examiner) {
+					Affine<float> a = rotate<Z>(R60) << translate(vector(1.0f, -2.0f, 0.5f)) << scale(vector(2.0f, 3.0f, 4.0f));
+					Affine<double> b = rotate<X>(R30) << translate(vector(1.0, 2.0, 3.0)) << scale(0.5);
+
+					examiner << "Single precision inverse matches 4x4 inverse." << std::endl;
+					examiner.check(Mat44(inverse(a)).equivalent(inverse(Mat44(a))));
+					examiner.check((a * inverse(a)).equivalent(Affine<float>(IDENTITY)));
+
+					examiner << "Double precision inverse matches 4x4 inverse." << std::endl;
+					examiner.check((b * inverse(b)).equivalent(Affine<double>(IDENTITY)));
+
+					Affine<float> transforms[3] = {a, a * a, inverse(a)};
+					inverse(transforms, transforms, 3);
+
+					examiner << "Batch inverse works in place." << std::endl;
+					examiner.check(transforms[1].equivalent(inverse(a * a)));
+					examiner.check(transforms[2].equivalent(a));
+				}
+			},
+
+			{"Transformation",
+				[](UnitTest::Examiner & examiner) {
+					Affine<float> a = rotate<Y>(R30) << translate(vector(1.0f, 2.0f, 3.0f)) << scale(vector(2.0f, 3.0f, 4.0f));
+					Mat44 m = a;
+
+					std::vector<Vec3> input, points(9), vectors(9);
+					for (std::size_t i = 0; i < 9; i += 1)
+						input.push_back(Vec3(i, 1.0f - i, i * 0.5f));
+
+					transform_points(a, input.data(), points.data(), input.size());
+					transform_vectors(a, input.data(), vectors.data(), input.size());
+
+					for (std::size_t i = 0; i < input.size(); i += 1) {
+						examiner << "Point " << i << " is transformed correctly." << std::endl;
+						examiner.check((a * input[i]).equivalent(m * input[i]));
+						examiner.check(points[i].equivalent(m * input[i]));
+						examiner.check(vectors[i].equivalent(transform_vector(a, input[i])));
+						examiner.check(vectors[i].equivalent((m * (input[i] << 0)).reduce()));
+					}
+				}
+			},
+		};
+	}
+}
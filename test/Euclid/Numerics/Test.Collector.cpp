@@ -0,0 +1,151 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Collector.hpp>
+#include <Euclid/Numerics/Average.hpp>
+#include <Euclid/Numerics/Distribution.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			const std::size_t THREADS = 4, SAMPLES = 200000;
+
+			// The sample added by a thread, so the expected statistics are known:
+			double sample_of (std::size_t thread, std::size_t index)
+			{
+				return double(thread * 1000 + index % 97);
+			}
+
+			template <typename FunctionT>
+			double nanoseconds_per_sample (FunctionT function)
+			{
+				return Benchmark::nanoseconds_per_item(THREADS * SAMPLES, 1, [&]{
+					std::vector<std::thread> workers;
+
+					for (std::size_t thread = 0; thread < THREADS; thread += 1)
+						workers.emplace_back(function, thread);
+
+					for (auto & worker : workers)
+						worker.join();
+				});
+			}
+		}
+
+		UnitTest::Suite CollectorTestSuite {
+			"Euclid::Numerics::Collector",
+
+			{"Collecting From Threads",
+				[](UnitTest::Examiner & examiner) {
+					Collector<StreamingDistribution<double>> collector;
+					StreamingDistribution<double> expected;
+
+					for (std::size_t thread = 0; thread < THREADS; thread += 1)
+						for (std::size_t index = 0; index < SAMPLES; index += 1)
+							expected += sample_of(thread, index);
+
+					std::atomic<bool> done(false);
+					std::size_t snapshots = 0, previous = 0;
+					bool monotonic = true;
+
+					// The reader takes snapshots while the threads are adding samples:
+					std::thread reader([&]{
+						while (!done) {
+							std::size_t count = collector.snapshot().number_of_samples();
+
+							if (count < previous) monotonic = false;
+
+							previous = count;
+							snapshots += 1;
+						}
+					});
+
+					nanoseconds_per_sample([&](std::size_t thread){
+						Collector<StreamingDistribution<double>>::Local local(collector);
+
+						for (std::size_t index = 0; index < SAMPLES; index += 1)
+							local += sample_of(thread, index);
+					});
+
+					done = true;
+					reader.join();
+
+					examiner << "The reader took " << snapshots << " snapshots while the threads were adding samples" << std::endl;
+					examiner.check(monotonic);
+
+					auto snapshot = collector.snapshot();
+
+					examiner << "The snapshot includes every sample once the threads are finished" << std::endl;
+					examiner.check_equal(snapshot.number_of_samples(), expected.number_of_samples());
+					examiner.check_equal(snapshot.minimum(), expected.minimum());
+					examiner.check_equal(snapshot.maximum(), expected.maximum());
+					examiner.check(std::abs(snapshot.average() - expected.average()) < 1e-9 * expected.average());
+					examiner.check(std::abs(snapshot.variance() - expected.variance()) < 1e-9 * expected.variance());
+					examiner.check_equal(snapshot.median(), expected.median());
+
+					examiner << "Slots are reused by later threads" << std::endl;
+					{
+						Collector<Average<double>> averages;
+
+						for (std::size_t round = 0; round < 3; round += 1) {
+							std::thread([&]{
+								Collector<Average<double>>::Local local(averages);
+								local += 2.0;
+								local += 4.0;
+							}).join();
+						}
+
+						examiner.check_equal(averages.slot_count(), 1);
+
+						auto average = averages.snapshot();
+						examiner.check_equal(average.number_of_samples(), 6);
+						examiner.check_equal(average.value(), 3);
+
+						// Statistics which exist at the same time need their own slots, which are reused once they are destroyed:
+						{
+							Collector<Average<double>>::Local first(averages), second(averages);
+							examiner.check_equal(averages.slot_count(), 2);
+						}
+
+						Collector<Average<double>>::Local third(averages);
+						examiner.check_equal(averages.slot_count(), 2);
+					}
+				}
+			},
+
+			{"Performance",
+				[](UnitTest::Examiner & examiner) {
+					std::mutex mutex;
+					StreamingDistribution<double> shared;
+
+					double locked = nanoseconds_per_sample([&](std::size_t thread){
+						for (std::size_t index = 0; index < SAMPLES; index += 1) {
+							std::lock_guard<std::mutex> lock(mutex);
+							shared += sample_of(thread, index);
+						}
+					});
+
+					Collector<StreamingDistribution<double>> collector;
+
+					double collected = nanoseconds_per_sample([&](std::size_t thread){
+						Collector<StreamingDistribution<double>>::Local local(collector);
+
+						for (std::size_t index = 0; index < SAMPLES; index += 1)
+							local += sample_of(thread, index);
+					});
+
+					examiner << "With " << THREADS << " threads, a shared mutex took " << locked << "ns and a Collector took " << collected << "ns per sample" << std::endl;
+					examiner.check_equal(collector.snapshot().number_of_samples(), shared.number_of_samples());
+				}
+			},
+		};
+	}
+}
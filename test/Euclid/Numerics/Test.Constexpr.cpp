@@ -0,0 +1,62 @@
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Vector.hpp>
+#include <Euclid/Numerics/Matrix.hpp>
+#include <Euclid/Numerics/Matrix.Multiply.hpp>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		// These are all evaluated by the compiler, so this file only compiles if they are constant expressions.
+		namespace
+		{
+			constexpr Vec3 A = {1, 2, 3};
+			constexpr Vec3 B = A * 2 + 1;
+			constexpr Vec3 C = -(B - A) / 2;
+			constexpr Vec4 D = A << 1;
+			constexpr Vec2 E = D.reduce<2>();
+			constexpr Vec3 F = Vec3(ZERO);
+			constexpr Vector<3, double> G = A;
+
+			static_assert(B[X] == 3 && B[Y] == 5 && B[Z] == 7, "Vector arithmetic is constant");
+			static_assert(C[X] == -1 && C[Z] == -2, "Vector negation is constant");
+			static_assert(D[W] == 1 && E[Y] == 2, "Vectors can be expanded and reduced");
+			static_assert(F[Y] == 0 && G[Z] == 3, "Vectors can be constructed from other vectors");
+			static_assert(A.dot(B) == 34 && A.sum() == 6 && A.product() == 6, "Vector reductions are constant");
+			static_assert(A.less_than(B) && !B.less_than(A), "Vector comparisons are constant");
+
+			constexpr Mat44 I = IDENTITY;
+			constexpr Mat44 M = translate(vector<RealT>(1, 2, 3)) << scale(vector<RealT>(2, 4, 8));
+			constexpr Mat44 N = M << translate(vector<RealT>(1, 1, 1)) << scale(RealT(0.5));
+
+			static_assert(I.at(2, 2) == 1 && I.at(2, 3) == 0, "Identity matrix is constant");
+			static_assert(M.at(0, 0) == 2 && M.at(1, 1) == 4 && M.at(2, 2) == 8, "Transform chains are constant");
+			static_assert(M.at(0, 3) == 1 && M.at(1, 3) == 2 && M.at(2, 3) == 3, "Transform chains are constant");
+			static_assert(N.at(0, 3) == 3 && N.at(2, 3) == 11 && N.at(2, 2) == 4, "Transform chains are constant");
+
+			constexpr Vec3 P = M * Vec3(1, 1, 1);
+			constexpr Mat44 Q = M * N;
+
+			static_assert(P[X] == 3 && P[Y] == 6 && P[Z] == 11, "Matrix vector multiplication is constant");
+			static_assert(Q.at(0, 3) == 7 && Q.transpose().at(3, 2) == Q.at(2, 3), "Matrix multiplication is constant");
+		}
+
+		UnitTest::Suite ConstexprTestSuite {
+			"Euclid::Numerics::Constexpr",
+
+			{"Compile Time Evaluation",
+				[](UnitTest::Examiner & examiner) {
+					examiner << "Constant transform chains match the runtime result." << std::endl;
+
+					Mat44 runtime = translate(vector<RealT>(1, 2, 3)) << scale(vector<RealT>(2, 4, 8));
+					examiner.check(runtime.equivalent(M));
+
+					examiner << "Constant products match the runtime result." << std::endl;
+					examiner.check((runtime * N).equivalent(Q));
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,228 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Distribution.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			// Latencies in seconds, which are log-normally distributed with a long tail:
+			std::vector<double> latencies (std::size_t count)
+			{
+				std::mt19937 rng(3);
+				std::lognormal_distribution<double> distribution(-7, 1.5);
+
+				std::vector<double> samples(count);
+
+				for (auto & sample : samples)
+					sample = distribution(rng);
+
+				return samples;
+			}
+
+			// The exact quantile using the nearest rank, which is what the sketch estimates:
+			double exact_quantile (std::vector<double> sorted, double fraction)
+			{
+				std::sort(sorted.begin(), sorted.end());
+
+				std::size_t rank = std::size_t(std::ceil(fraction * sorted.size()));
+
+				return sorted[rank > 0 ? rank - 1 : 0];
+			}
+		}
+
+		UnitTest::Suite DistributionTestSuite {
+			"Euclid::Numerics::Distribution",
+
+			{"Streaming Statistics",
+				[](UnitTest::Examiner & examiner) {
+					Distribution<double> distribution;
+					StreamingDistribution<double> streaming;
+
+					for (auto sample : latencies(10000)) {
+						distribution.add_sample(sample);
+						streaming.add_sample(sample);
+					}
+
+					examiner << "The statistics are the same as the distribution which keeps the samples" << std::endl;
+					examiner.check_equal(streaming.number_of_samples(), distribution.number_of_samples());
+					examiner.check_equal(streaming.minimum(), distribution.minimum());
+					examiner.check_equal(streaming.maximum(), distribution.maximum());
+					examiner.check(number(streaming.average()).equivalent(distribution.average()));
+					examiner.check(std::abs(streaming.variance() - distribution.variance().value()) < 1e-9 * distribution.variance().value());
+					examiner.check(std::abs(streaming.standard_error() - distribution.standard_error()) < 1e-9);
+
+					examiner << "The sample variance is unbiased" << std::endl;
+					StreamingDistribution<float> small;
+					small += 2;
+					small += 4;
+					examiner.check_equal(small.variance(), 1);
+					examiner.check_equal(small.sample_variance(), 2);
+
+					examiner << "Large offsets don't lose the variance" << std::endl;
+					StreamingDistribution<double> offset;
+					for (double sample : {1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16})
+						offset += sample;
+					examiner.check(number(offset.sample_variance()).equivalent(30));
+				}
+			},
+
+			{"Quantiles",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<double> samples = latencies(200000);
+					StreamingDistribution<double> streaming;
+
+					for (auto sample : samples)
+						streaming += sample;
+
+					for (double fraction : {0.5, 0.9, 0.99, 0.999}) {
+						double exact = exact_quantile(samples, fraction), estimate = streaming.quantile(fraction);
+
+						examiner << "The quantile " << fraction << " is " << estimate << ", and should be " << exact << std::endl;
+						examiner.check(std::abs(estimate - exact) <= exact / (2 * QuantileSketch::SUBDIVISIONS));
+					}
+
+					examiner << "The extreme quantiles are exact" << std::endl;
+					examiner.check_equal(streaming.quantile(0), streaming.minimum());
+					examiner.check_equal(streaming.quantile(1), streaming.maximum());
+
+					examiner << "The memory is bounded by the range of the samples" << std::endl;
+					examiner << "There are " << streaming.quantiles().number_of_buckets() << " buckets" << std::endl;
+					examiner.check(streaming.quantiles().number_of_buckets() < 2048);
+
+					examiner << "Negative numbers and zero are ordered correctly" << std::endl;
+					StreamingDistribution<float> signed_samples;
+					for (float sample : {-100.0f, -1.0f, 0.0f, 0.0f, 2.0f, 50.0f, 1e30f})
+						signed_samples += sample;
+					examiner.check(std::abs(signed_samples.quantile(0.2) + 1) < 0.01);
+					examiner.check_equal(signed_samples.median(), 0);
+					examiner.check(std::abs(signed_samples.quantile(0.7) - 2) < 0.02);
+					examiner.check_equal(signed_samples.quantile(1), 1e30f);
+				}
+			},
+
+			{"Merging",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<double> samples = latencies(100000);
+
+					// Offset the samples so that the means of the parts differ from each other, which is where a naive combination of the variances goes wrong:
+					for (std::size_t i = 0; i < samples.size(); i += 1)
+						samples[i] += 1000.0 * (i * 4 / samples.size());
+
+					StreamingDistribution<double> whole, parts[4], merged;
+
+					for (std::size_t i = 0; i < samples.size(); i += 1) {
+						whole += samples[i];
+						parts[i * 4 / samples.size()] += samples[i];
+					}
+
+					for (auto & part : parts)
+						merged += part;
+
+					examiner << "Merging the parts gives the same statistics as the whole" << std::endl;
+					examiner.check_equal(merged.number_of_samples(), whole.number_of_samples());
+					examiner.check_equal(merged.minimum(), whole.minimum());
+					examiner.check_equal(merged.maximum(), whole.maximum());
+					examiner.check(std::abs(merged.average() - whole.average()) < 1e-9 * whole.average());
+					examiner.check(std::abs(merged.variance() - whole.variance()) < 1e-9 * whole.variance());
+
+					examiner << "The quantiles are merged exactly" << std::endl;
+					for (double fraction : {0.1, 0.5, 0.9, 0.99})
+						examiner.check_equal(merged.quantile(fraction), whole.quantile(fraction));
+					examiner.check_equal(merged.quantiles().number_of_samples(), whole.quantiles().number_of_samples());
+
+					examiner << "Merging an empty distribution changes nothing" << std::endl;
+					StreamingDistribution<double> empty;
+					merged += empty;
+					empty += merged;
+					examiner.check_equal(merged.number_of_samples(), whole.number_of_samples());
+					examiner.check_equal(empty.variance(), merged.variance());
+
+					Distribution<double> first, second;
+					first.add_sample(1);
+					first.add_sample(3);
+					second.add_sample(-5);
+					second.add_sample(9);
+					first.add_samples(second);
+
+					examiner << "Distribution merges its samples" << std::endl;
+					examiner.check_equal(first.number_of_samples(), 4);
+					examiner.check_equal(first.minimum(), -5);
+					examiner.check_equal(first.maximum(), 9);
+					examiner.check_equal(first.average(), 2);
+				}
+			},
+
+			{"Not a Number",
+				[](UnitTest::Examiner & examiner) {
+					const double nan = std::numeric_limits<double>::quiet_NaN();
+
+					StreamingDistribution<double> streaming, other;
+
+					for (double sample : {4.0, nan, 2.0, 6.0, nan})
+						streaming += sample;
+
+					examiner << "NaN samples are counted, but left out of the statistics" << std::endl;
+					examiner.check_equal(streaming.number_of_samples(), 3);
+					examiner.check_equal(streaming.number_of_ignored_samples(), 2);
+					examiner.check_equal(streaming.minimum(), 2);
+					examiner.check_equal(streaming.maximum(), 6);
+					examiner.check_equal(streaming.average(), 4);
+					examiner.check(std::abs(streaming.median() - 4) < 4.0 / QuantileSketch::SUBDIVISIONS);
+					examiner.check_equal(streaming.quantiles().number_of_samples(), 3);
+
+					examiner << "The ignored samples are merged" << std::endl;
+					other += nan;
+					other += streaming;
+					examiner.check_equal(other.number_of_samples(), 3);
+					examiner.check_equal(other.number_of_ignored_samples(), 3);
+					examiner.check_equal(other.average(), 4);
+
+					examiner << "The quantile sketch ignores NaN" << std::endl;
+					QuantileSketch sketch;
+					sketch.add_sample(nan);
+					examiner.check_equal(sketch.number_of_samples(), 0);
+					examiner.check_equal(sketch.number_of_buckets(), 0);
+
+					streaming.clear();
+					examiner.check_equal(streaming.number_of_ignored_samples(), 0);
+				}
+			},
+
+			{"Performance",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<double> samples = latencies(1000000);
+
+					Distribution<double> distribution;
+					StreamingDistribution<double> streaming;
+
+					double keeping = Benchmark::nanoseconds_per_item(samples.size(), 1, [&]{
+						for (auto sample : samples)
+							distribution.add_sample(sample);
+
+						distribution.variance();
+					});
+
+					double welford = Benchmark::nanoseconds_per_item(samples.size(), 1, [&]{
+						for (auto sample : samples)
+							streaming.add_sample(sample);
+
+						streaming.variance();
+					});
+
+					examiner << "Distribution took " << keeping << "ns and StreamingDistribution took " << welford << "ns per sample" << std::endl;
+					examiner.check(number(streaming.average()).equivalent(distribution.average()));
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,86 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/DualQuaternion.hpp>
+#include <Euclid/Numerics/Matrix.Multiply.hpp>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		UnitTest::Suite DualQuaternionTestSuite {
+			"Euclid::Numerics::DualQuaternion",
+
+			{"Construction",
+				[](UnitTest::Examiner & examiner) {
+					DualQuat identity(IDENTITY);
+
+					examiner << "Identity has no translation or rotation" << std::endl;
+					examiner.check(identity.translation().equivalent(0));
+					examiner.check(identity.rotation().equivalent(Quat(IDENTITY)));
+
+					DualQuat transform(Vec3(1, 2, 3), rotate<Z>(R90));
+
+					examiner << "Translation and rotation are recovered" << std::endl;
+					examiner.check(transform.translation().equivalent({1, 2, 3}));
+					examiner.check(transform.rotation().equivalent(Quat(rotate<Z>(R90))));
+
+					Affine<RealT> affine = transform;
+
+					examiner << "Conversion to an affine transform is correct" << std::endl;
+					examiner.check(affine.equivalent(Affine<RealT>(translate(Vec3(1, 2, 3)) << rotate<Z>(R90))));
+					examiner.check(DualQuat(affine).equivalent(transform));
+				}
+			},
+
+			{"Transformation",
+				[](UnitTest::Examiner & examiner) {
+					DualQuat a(Vec3(1, 2, 3), rotate<Z>(R90)), b(Vec3(-2, 0, 1), rotate<X>(R30));
+					Mat44 m = Affine<RealT>(a), n = Affine<RealT>(b);
+
+					Vec3 point(4, -1, 2);
+
+					examiner << "Points are rotated and then translated" << std::endl;
+					examiner.check((a * point).equivalent(m * point));
+
+					examiner << "Composition is the same as matrix multiplication" << std::endl;
+					examiner.check(((a * b) * point).equivalent((m * n) * point));
+
+					examiner << "The conjugate is the inverse" << std::endl;
+					examiner.check((a.conjugate() * (a * point)).equivalent(point));
+
+					DualQuat scaled(Quat(Vector<4, RealT>(a.real) * RealT(2)), Quat(Vector<4, RealT>(a.dual) * RealT(2)));
+
+					examiner << "Normalization restores a rigid transform" << std::endl;
+					examiner.check(scaled.normalize().equivalent(a));
+				}
+			},
+
+			{"Skinning",
+				[](UnitTest::Examiner & examiner) {
+					DualQuat palette[2] = {{Vec3(1, 2, 3), rotate<Z>(R90)}, {Vec3(-2, 0, 1), rotate<X>(R30)}};
+					BoneInfluences influences[3] = {
+						{{0, 1, 0, 0}, {1, 0, 0, 0}},
+						{{1, 0, 0, 0}, {1, 0, 0, 0}},
+						{{0, 1, 0, 0}, {0.5, 0.5, 0, 0}},
+					};
+
+					Vec3 positions[3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}, normals[3] = {{0, 0, 1}, {1, 0, 0}, {0, 1, 0}};
+					Vec3 skinned_positions[3], skinned_normals[3];
+
+					skin_vertices(palette, influences, positions, normals, sizeof(Vec3), skinned_positions, skinned_normals, 3);
+
+					examiner << "Vertices influenced by a single bone are transformed by it" << std::endl;
+					examiner.check(skinned_positions[0].equivalent(palette[0] * positions[0]));
+					examiner.check(skinned_normals[0].equivalent(palette[0].transform_vector(normals[0])));
+					examiner.check(skinned_positions[1].equivalent(palette[1] * positions[1]));
+
+					examiner << "Blended vertices are transformed by the normalized blend" << std::endl;
+					DualQuat blended = blend(palette, influences[2]).normalize();
+					examiner.check(skinned_positions[2].equivalent(blended * positions[2]));
+					examiner.check(skinned_normals[2].equivalent(blended.transform_vector(normals[2])));
+					examiner.check(number(skinned_normals[2].length()).equivalent(1));
+				}
+			},
+		};
+	}
+}
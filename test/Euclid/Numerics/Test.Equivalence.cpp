@@ -0,0 +1,187 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Equivalence.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			// The number of times each benchmark is repeated:
+			const std::size_t PASSES = 20;
+
+			// Move a number by the given number of representable values:
+			float offset (float value, int units)
+			{
+				for (; units > 0; units -= 1) value = std::nextafter(value, std::numeric_limits<float>::infinity());
+				for (; units < 0; units += 1) value = std::nextafter(value, -std::numeric_limits<float>::infinity());
+
+				return value;
+			}
+
+			// Pairs of numbers which are equivalent to varying degrees, including the edge cases:
+			void pairs (std::vector<float> & a, std::vector<float> & b)
+			{
+				const float NAN_VALUE = std::numeric_limits<float>::quiet_NaN(), INFINITE = std::numeric_limits<float>::infinity();
+				const float SPECIAL[][2] = {
+					{0, 0}, {0, -0.0f}, {1e-7f, -1e-7f}, {1e-3f, 1.001e-3f}, {1, -1}, {1, 0.9999999f},
+					{NAN_VALUE, NAN_VALUE}, {NAN_VALUE, 1}, {INFINITE, INFINITE}, {INFINITE, -INFINITE}, {std::numeric_limits<float>::max(), INFINITE},
+				};
+
+				for (auto & pair : SPECIAL) {
+					a.push_back(pair[0]);
+					b.push_back(pair[1]);
+				}
+
+				for (std::size_t i = 0; i < 997; i += 1) {
+					float value = (float(i % 37) - 18) * std::pow(10.0f, float(i % 9) - 4);
+					int units = int(i % 23) - 11;
+
+					a.push_back(value);
+					b.push_back(offset(value, units));
+				}
+			}
+		}
+
+		UnitTest::Suite EquivalenceTestSuite {
+			"Euclid::Numerics::Equivalence",
+
+			{"Tolerance",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<float> a, b;
+					pairs(a, b);
+
+					examiner << "The default tolerance is the same as equivalent" << std::endl;
+					for (std::size_t i = 0; i < a.size(); i += 1)
+						examiner.check(Tolerance<float>().equivalent(a[i], b[i]) == equivalent(a[i], b[i]));
+
+					examiner << "The tolerance can be given in units in the last place" << std::endl;
+					examiner.check(Tolerance<float>(2).equivalent(100, offset(100, 2)));
+					examiner.check(!Tolerance<float>(2).equivalent(100, offset(100, 3)));
+					examiner.check(Tolerance<float>(0).equivalent(100, 100));
+
+					examiner << "Numbers near zero are compared with epsilon" << std::endl;
+					examiner.check(Tolerance<float>(0, 0.1f).equivalent(0.5f, 0.55f));
+					examiner.check(!Tolerance<float>(0, 0.01f).equivalent(0.5f, 0.55f));
+				}
+			},
+
+			{"Components",
+				[](UnitTest::Examiner & examiner) {
+					Vec4 a(1, 2, 3, 4), b(1, offset(2, 1), 3.5, 4);
+
+					Vec4b mask = a.equivalent_components(b);
+
+					examiner << "Each component is compared" << std::endl;
+					examiner.check(mask[X] && mask[Y] && !mask[Z] && mask[W]);
+
+					examiner << "Masks can be reduced" << std::endl;
+					examiner.check(!all(mask));
+					examiner.check(any(mask));
+					examiner.check(all(a.equivalent_components(a)));
+					examiner.check(!any(a.equivalent_components(a + 1)));
+				}
+			},
+
+			{"Batch",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<float> a, b;
+					pairs(a, b);
+
+					for (auto tolerance : {Tolerance<float>(), Tolerance<float>(0), Tolerance<float>(3), Tolerance<float>(1000)}) {
+						std::unique_ptr<bool[]> results(new bool[a.size()]);
+						equivalent(a.data(), b.data(), results.get(), a.size(), tolerance);
+
+						bool matches = true;
+						std::size_t first_difference = a.size(), first_equivalent = a.size(), later_difference = a.size();
+
+						for (std::size_t i = 0; i < a.size(); i += 1) {
+							bool expected = tolerance.equivalent(a[i], b[i]);
+							matches = matches && results[i] == expected;
+
+							if (!expected && first_difference == a.size()) first_difference = i;
+							if (expected && first_equivalent == a.size()) first_equivalent = i;
+							if (!expected && i >= 11 && later_difference == a.size()) later_difference = i;
+						}
+
+						examiner << "Batch equivalence with " << tolerance.units << " units is the same as the scalar equivalence" << std::endl;
+						examiner.check(matches);
+
+						examiner.check(find_difference(a.data(), b.data(), a.size(), tolerance) == first_difference);
+						examiner.check(find_equivalent(a.data(), b.data(), a.size(), true, tolerance) == first_equivalent);
+
+						// Skip the special cases, so that the search starts at an unaligned address:
+						examiner.check(find_difference(a.data() + 11, b.data() + 11, a.size() - 11, tolerance) == later_difference - 11);
+					}
+
+					examiner << "Identical arrays are all equivalent" << std::endl;
+					examiner.check(all_equivalent(b.data() + 11, b.data() + 11, b.size() - 11));
+					examiner.check(!all_equivalent(a.data(), a.data(), a.size()));
+					examiner.check(any_equivalent(a.data(), b.data(), a.size()));
+					examiner.check(!any_equivalent(a.data(), a.data(), 0));
+				}
+			},
+
+			{"Vectors and Matrices",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t COUNT = 1 << 18;
+
+					std::vector<Vec4> a(COUNT), b;
+					for (std::size_t i = 0; i < COUNT; i += 1)
+						a[i] = Vec4(RealT(i), RealT(i % 7) - 3, 1 / RealT(i + 1), RealT(i) * 1e-3f);
+
+					b = a;
+					b[COUNT - 3][X] = offset(b[COUNT - 3][X], 100);
+
+					examiner << "The first vector which differs is found" << std::endl;
+					examiner.check(find_difference(a.data(), b.data(), COUNT) == COUNT - 3);
+					examiner.check(!all_equivalent(a.data(), b.data(), COUNT));
+					examiner.check(all_equivalent(a.data(), b.data(), COUNT - 3));
+
+					std::vector<Mat44> m(3, Mat44(IDENTITY)), n = m;
+					n[2].at(1, 2) = 0.1f;
+
+					examiner << "The first matrix which differs is found" << std::endl;
+					examiner.check(find_difference(m.data(), n.data(), 3) == 2);
+					examiner.check(all_equivalent(m.data(), n.data(), 2));
+
+					bool result = false;
+
+					double scalar = Benchmark::nanoseconds_per_item(COUNT * 4, PASSES, [&]{
+						result = true;
+
+						for (std::size_t i = 0; i < COUNT && result; i += 1)
+							result = a[i].equivalent(a[i]);
+					});
+
+					examiner.check(result);
+
+					double batch = Benchmark::nanoseconds_per_item(COUNT * 4, PASSES, [&]{
+						result = all_equivalent(a.data(), a.data(), COUNT);
+					});
+
+					examiner.check(result);
+
+					// The comparison stops at the first difference, half way through:
+					b[COUNT / 2][X] = offset(b[COUNT / 2][X], 100);
+
+					double early = Benchmark::nanoseconds_per_item(COUNT * 4, PASSES, [&]{
+						result = all_equivalent(a.data(), b.data(), COUNT);
+					});
+
+					examiner.check(!result);
+
+					examiner << "Vector::equivalent took " << scalar << "ns, all_equivalent took " << batch << "ns per number, and " << early << "ns when the comparison stops half way" << std::endl;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,78 @@
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Expression.hpp>
+#include <Euclid/Numerics/Matrix.Multiply.hpp>
+#include <Euclid/Numerics/Vector.IO.hpp>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		UnitTest::Suite ExpressionTestSuite {
+			"Euclid::Numerics::Expression",
+
+			{"Vector Expressions",
+				[](UnitTest::Examiner & examiner) {
+					Vec3 a = {1, 2, 3}, b = {4, 5, 6}, c = {-1, 0.5, 2};
+					RealT s = 2.5;
+
+					examiner << "Lazy expressions match the standard operators." << std::endl;
+					Vec3 d = lazy(a) + lazy(b) * s - c;
+					examiner.check_equal(d, a + b * s - c);
+
+					Vec3 e = -lazy(a) / 2 + a * b;
+					examiner.check_equal(e, -a / 2 + a * b);
+
+					Vec3 f = 3 * lazy(a) - 1;
+					examiner.check_equal(f, a * 3 - 1);
+
+					examiner << "Vectors can appear on the left of an expression." << std::endl;
+					Vec3 g = c - lazy(a) * b;
+					examiner.check_equal(g, c - a * b);
+				}
+			},
+
+			{"Assignment",
+				[](UnitTest::Examiner & examiner) {
+					Vec3 a = {1, 2, 3}, b = {4, 5, 6};
+
+					Vec3 c = a;
+					c += lazy(b) * 2;
+					examiner.check_equal(c, a + b * 2);
+
+					examiner << "The destination may appear in the expression." << std::endl;
+					c = lazy(c) - a;
+					examiner.check_equal(c, b * 2);
+
+					c *= lazy(a) + 1;
+					examiner.check_equal(c, (b * 2) * (a + 1));
+				}
+			},
+
+			{"Matrix Expressions",
+				[](UnitTest::Examiner & examiner) {
+					Mat44 m = rotate<Z>(R90) << translate(vector<RealT>(1, 2, 3));
+					Mat44 n(IDENTITY);
+					Vec4 v = {1, 2, 3, 1}, u = {0, 1, 0, 0};
+
+					examiner << "Matrix-vector products are fused with the surrounding expression." << std::endl;
+					Vec4 r = lazy(m) * v + u;
+					examiner.check(r.equivalent(m * v + u));
+
+					Vec4 q = m * (lazy(v) * 2 - u);
+					examiner.check(q.equivalent(m * (v * 2 - u)));
+
+					examiner << "Matrices are added element-wise." << std::endl;
+					Mat44 sum = lazy(m) + lazy(n) * 2;
+
+					for (std::size_t i = 0; i < 16; i += 1)
+						examiner.check(number(sum[i]).equivalent(m[i] + n[i] * 2));
+
+					Vec4 p = (lazy(m) - n) * v;
+					examiner.check(p.equivalent(m * v - v));
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,194 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/GradientNoise.hpp>
+#include <Euclid/Numerics/PerlinNoise.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <random>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			template <dimension E>
+			std::vector<Vector<E>> random_points (std::size_t count)
+			{
+				std::mt19937 rng(17);
+				std::uniform_real_distribution<RealT> distribution(-50, 50);
+
+				std::vector<Vector<E>> points(count);
+
+				for (auto & point : points)
+					for (dimension i = 0; i < E; i += 1)
+						point[i] = distribution(rng);
+
+				return points;
+			}
+
+			// The largest difference between the analytic derivative and a central difference, relative to the size of the derivative:
+			template <dimension E, typename FunctionT>
+			RealT derivative_error (FunctionT function)
+			{
+				const RealT H = 1.0 / 256;
+				RealT error = 0;
+
+				for (auto & point : random_points<E>(1000)) {
+					Vector<E> derivative;
+					function(point, &derivative);
+
+					for (dimension i = 0; i < E; i += 1) {
+						Vector<E> delta = ZERO;
+						delta[i] = H;
+
+						RealT difference = (function(point + delta, nullptr) - function(point - delta, nullptr)) / (2 * H);
+
+						error = std::max(error, std::abs(difference - derivative[i]) / (1 + std::abs(derivative[i])));
+					}
+				}
+
+				return error;
+			}
+
+			template <dimension E, typename FunctionT>
+			RealT maximum_value (FunctionT function)
+			{
+				RealT maximum = 0;
+
+				for (auto & point : random_points<E>(20000))
+					maximum = std::max(maximum, std::abs(function(point)));
+
+				return maximum;
+			}
+
+			template <typename PointT, typename FunctionT>
+			double nanoseconds_per_sample (const std::vector<PointT> & points, FunctionT function)
+			{
+				RealT total = 0;
+
+				double duration = Benchmark::nanoseconds_per_item(points.size(), 1, [&]{
+					for (auto & point : points)
+						total += function(point);
+				});
+
+				// Use the total so that the loop isn't removed:
+				return duration + (total == 12345 ? 1 : 0);
+			}
+		}
+
+		UnitTest::Suite GradientNoiseTestSuite {
+			"Euclid::Numerics::GradientNoise",
+
+			{"Gradient Noise",
+				[](UnitTest::Examiner & examiner) {
+					GradientNoise noise(42);
+
+					examiner << "Noise is zero at the lattice points" << std::endl;
+					examiner.check_equal(noise.gradient(Vec2(3, -4)), 0);
+					examiner.check_equal(noise.gradient(Vec3(1, 2, 3)), 0);
+					examiner.check_equal(noise.gradient(Vec4(-1, 0, 7, 2)), 0);
+
+					examiner << "Noise is the same for the same seed" << std::endl;
+					examiner.check_equal(noise.gradient(Vec3(1.5, 2.25, -3.75)), GradientNoise(42).gradient(Vec3(1.5, 2.25, -3.75)));
+					examiner.check(noise.gradient(Vec3(1.5, 2.25, -3.75)) != GradientNoise(43).gradient(Vec3(1.5, 2.25, -3.75)));
+
+					RealT maximum[3] = {
+						maximum_value<2>([&](const Vec2 & at){return noise.gradient(at);}),
+						maximum_value<3>([&](const Vec3 & at){return noise.gradient(at);}),
+						maximum_value<4>([&](const Vec4 & at){return noise.gradient(at);}),
+					};
+
+					examiner << "The largest values are " << maximum[0] << ", " << maximum[1] << " and " << maximum[2] << std::endl;
+					for (auto value : maximum)
+						examiner.check(value > 0.5 && value < 1.2);
+
+					RealT error[3] = {
+						derivative_error<2>([&](const Vec2 & at, Vec2 * derivative){return derivative ? noise.gradient(at, *derivative) : noise.gradient(at);}),
+						derivative_error<3>([&](const Vec3 & at, Vec3 * derivative){return derivative ? noise.gradient(at, *derivative) : noise.gradient(at);}),
+						derivative_error<4>([&](const Vec4 & at, Vec4 * derivative){return derivative ? noise.gradient(at, *derivative) : noise.gradient(at);}),
+					};
+
+					examiner << "The derivatives match the central differences with error " << error[0] << ", " << error[1] << " and " << error[2] << std::endl;
+					for (auto value : error)
+						examiner.check(value < 1e-2);
+
+					Vec3 derivative;
+					examiner << "The value is the same with the derivative" << std::endl;
+					examiner.check_equal(noise.gradient(Vec3(0.3, 0.6, 0.9), derivative), noise.gradient(Vec3(0.3, 0.6, 0.9)));
+				}
+			},
+
+			{"Simplex Noise",
+				[](UnitTest::Examiner & examiner) {
+					GradientNoise noise(7);
+
+					examiner << "Noise is zero at the corners of the simplices" << std::endl;
+					examiner.check_equal(noise.simplex(Vec2(0, 0)), 0);
+					examiner.check_equal(noise.simplex(Vec3(0, 0, 0)), 0);
+
+					RealT maximum[3] = {
+						maximum_value<2>([&](const Vec2 & at){return noise.simplex(at);}),
+						maximum_value<3>([&](const Vec3 & at){return noise.simplex(at);}),
+						maximum_value<4>([&](const Vec4 & at){return noise.simplex(at);}),
+					};
+
+					examiner << "The largest values are " << maximum[0] << ", " << maximum[1] << " and " << maximum[2] << std::endl;
+					for (auto value : maximum)
+						examiner.check(value > 0.5 && value < 1.05);
+
+					RealT error[3] = {
+						derivative_error<2>([&](const Vec2 & at, Vec2 * derivative){return derivative ? noise.simplex(at, *derivative) : noise.simplex(at);}),
+						derivative_error<3>([&](const Vec3 & at, Vec3 * derivative){return derivative ? noise.simplex(at, *derivative) : noise.simplex(at);}),
+						derivative_error<4>([&](const Vec4 & at, Vec4 * derivative){return derivative ? noise.simplex(at, *derivative) : noise.simplex(at);}),
+					};
+
+					examiner << "The derivatives match the central differences with error " << error[0] << ", " << error[1] << " and " << error[2] << std::endl;
+					for (auto value : error)
+						examiner.check(value < 1e-2);
+
+					examiner << "Noise is continuous across the simplices" << std::endl;
+					examiner.check(std::abs(noise.simplex(Vec3(0.4999, 0.5, 0.25)) - noise.simplex(Vec3(0.5001, 0.5, 0.25))) < 1e-2);
+				}
+			},
+
+			{"Performance",
+				[](UnitTest::Examiner & examiner) {
+					GradientNoise noise(1);
+					PerlinNoise value_noise(1);
+
+					auto points2 = random_points<2>(200000);
+					auto points3 = random_points<3>(200000);
+
+					double value = nanoseconds_per_sample(points3, [&](const Vec3 & at){return value_noise.sample(at);});
+					double gradient2 = nanoseconds_per_sample(points2, [&](const Vec2 & at){return noise.gradient(at);});
+					double gradient3 = nanoseconds_per_sample(points3, [&](const Vec3 & at){return noise.gradient(at);});
+					double simplex2 = nanoseconds_per_sample(points2, [&](const Vec2 & at){return noise.simplex(at);});
+					double simplex3 = nanoseconds_per_sample(points3, [&](const Vec3 & at){return noise.simplex(at);});
+
+					examiner << "PerlinNoise::sample took " << value << "ns, gradient took " << gradient2 << "ns in 2D and " << gradient3 << "ns in 3D, simplex took " << simplex2 << "ns in 2D and " << simplex3 << "ns in 3D" << std::endl;
+
+					// A height field normal needs the derivative, which would otherwise need at least two more samples:
+					double analytic = nanoseconds_per_sample(points2, [&](const Vec2 & at){
+						Vec2 derivative;
+						RealT height = noise.simplex(at, derivative);
+
+						return height + Vec3(-derivative[X], -derivative[Y], 1).normalize()[Z];
+					});
+
+					double differences = nanoseconds_per_sample(points2, [&](const Vec2 & at){
+						const RealT H = 1.0 / 256;
+						RealT height = noise.simplex(at);
+						RealT dx = (noise.simplex(at + Vec2(H, 0)) - height) / H, dy = (noise.simplex(at + Vec2(0, H)) - height) / H;
+
+						return height + Vec3(-dx, -dy, 1).normalize()[Z];
+					});
+
+					examiner << "A simplex height and normal took " << analytic << "ns with the derivative, and " << differences << "ns with differences" << std::endl;
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,374 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Instructions.hpp>
+#include <Euclid/Numerics/Matrix.Inverse.hpp>
+#include <Euclid/Numerics/Affine.hpp>
+#include <Euclid/Numerics/VectorArray.hpp>
+#include <Euclid/Numerics/Matrix.Projections.hpp>
+#include <Euclid/Numerics/Quaternion.Interpolate.hpp>
+#include <Euclid/Numerics/DualQuaternion.hpp>
+#include <Euclid/Numerics/Trigonometry.hpp>
+#include <Euclid/Numerics/Equivalence.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			typedef Matrix<4, 4, float> Mat44f;
+			typedef Matrix<4, 4, double> Mat44d;
+			typedef Vector<3, float> Vec3f;
+
+			struct Results {
+				Mat44f product;
+				Mat44d product_double;
+				Vector<4, float> column;
+				Mat44f products[5];
+				Mat44f inverse, inverse_affine;
+				Mat44d inverse_double;
+				Affine<float> affine_product, affine_inverse;
+				Quaternion<float> rotation;
+				Quaternion<double> rotation_double;
+				std::vector<Quaternion<float>> composed, interpolated[3];
+				std::vector<Quaternion<double>> composed_double;
+				std::vector<Vec3f> points, projected, vectors, rotated, skinned_positions, skinned_normals;
+				std::vector<Vec3> normalized;
+				std::vector<float> sines, cosines, arc_cosines, arc_tangents;
+				bool equivalences[19];
+				std::size_t first_difference, first_equivalent;
+			};
+
+			const DualQuaternion<float> palette[3] = {
+				{vector(1.0f, 2.0f, 3.0f), rotate<Z>(R90)},
+				{vector(-4.0f, 0.0f, 1.0f), rotate<X>(R30)},
+				{vector(0.0f, 1.0f, 0.0f), rotate<Y>(R45)},
+			};
+
+			std::vector<BoneInfluences> influences (std::size_t count)
+			{
+				std::vector<BoneInfluences> result;
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					float weight = float(i % 5) / 4;
+					result.push_back({{std::uint16_t(i % 3), std::uint16_t((i + 1) % 3), 0, 0}, {weight, 1 - weight, 0, 0}});
+				}
+
+				return result;
+			}
+
+			void skin (Results & results, const std::vector<Vec3f> & input)
+			{
+				// The input vectors are used as both positions and normals:
+				skin_vertices(palette, influences(input.size()).data(), input.data(), input.data(), sizeof(Vec3f), results.skinned_positions.data(), results.skinned_normals.data(), input.size());
+			}
+
+			// Evaluate every dispatched kernel using the currently selected instructions:
+			Results evaluate ()
+			{
+				Mat44f a = rotate<Z>(R30) << translate(vector(1.0f, 2.0f, 3.0f)) << scale(vector(2.0f, 3.0f, 4.0f));
+				Mat44f b = perspective_projection_matrix<float>(R90, 1.0f, 0.1f, 100.0f);
+				Mat44d c = rotate<X>(R60) << translate(vector(-1.0, 0.5, 2.0));
+
+				Results results;
+
+				results.product = a * b;
+				results.product_double = c * Mat44d(rotate<Y>(R45));
+				results.column = a * vector(1.0f, 2.0f, 3.0f, 1.0f);
+
+				Mat44f left[5] = {a, b, a, b, a}, right[5] = {b, a, a, b, b};
+				multiply(results.products, left, right, 5);
+
+				results.inverse = inverse(b);
+				results.inverse_affine = inverse_affine(a);
+				results.inverse_double = inverse(c);
+
+				Affine<float> d = a, e = rotate<Y>(R45) << translate(vector(4.0f, 5.0f, 6.0f));
+				results.affine_product = d * e;
+				results.affine_inverse = inverse(d);
+
+				Quaternion<float> q1(R30, vector(1.0f, 2.0f, 3.0f).normalize()), q2(R60, vector(0.0f, -1.0f, 1.0f).normalize());
+				results.rotation = q1 * q2;
+
+				Quaternion<double> q3(R45, vector(0.0, 0.0, 1.0)), q4(R90, vector(1.0, 0.0, 0.0));
+				results.rotation_double = q3 * q4;
+
+				std::vector<Quaternion<float>> first, second;
+				std::vector<Quaternion<double>> first_double, second_double;
+				for (std::size_t i = 0; i < 7; i += 1) {
+					first.push_back(Quaternion<float>(R30 * float(i), vector(0.0f, 1.0f, 0.0f)));
+					second.push_back(Quaternion<float>(R45, vector(1.0f, 0.0f, float(i)).normalize()));
+					first_double.push_back(Quaternion<double>(R30 * double(i), vector(1.0, 0.0, 0.0)));
+					second_double.push_back(Quaternion<double>(R60, vector(0.0, double(i), 1.0).normalize()));
+				}
+
+				results.composed = first;
+				compose_quaternions(first.data(), second.data(), results.composed.data(), first.size());
+				results.composed_double = first_double;
+				compose_quaternions(first_double.data(), second_double.data(), results.composed_double.data(), first_double.size());
+
+				std::vector<float> factors;
+				for (std::size_t i = 0; i < first.size(); i += 1)
+					factors.push_back(float(i) / 6);
+
+				for (auto mode : {QuaternionInterpolation::SPHERICAL, QuaternionInterpolation::NORMALIZED, QuaternionInterpolation::FAST_SPHERICAL}) {
+					auto & interpolated = results.interpolated[std::size_t(mode)];
+					interpolated = first;
+					interpolate_quaternions(mode, first.data(), second.data(), factors.data(), interpolated.data(), first.size());
+				}
+
+				std::vector<Vec3f> input;
+				for (std::size_t i = 0; i < 19; i += 1)
+					input.push_back(vector(float(i), float(i) * 0.5f - 3.0f, 1.0f - float(i) * 0.25f));
+
+				results.points = results.projected = results.vectors = results.rotated = input;
+				transform_points(a, input.data(), results.points.data(), input.size());
+				transform_points_projective(b, input.data(), results.projected.data(), input.size());
+				transform_vectors(a, input.data(), results.vectors.data(), input.size());
+				rotate_vectors(q1, input.data(), results.rotated.data(), input.size());
+
+				results.skinned_positions = results.skinned_normals = input;
+				skin(results, input);
+
+				std::vector<Vec3> vectors;
+				for (std::size_t i = 0; i < 19; i += 1)
+					vectors.push_back(vector<RealT>(i, 1, -RealT(i) * 2));
+				vectors.push_back(ZERO);
+
+				Vec3Array array = vectors;
+				normalize(array, array);
+				results.normalized = array;
+
+				std::vector<float> angles, coordinates;
+				for (std::size_t i = 0; i < 19; i += 1) {
+					angles.push_back(float(i) * 0.75f - 7.0f);
+					coordinates.push_back(float(i) / 9 - 1.0f);
+				}
+
+				results.sines = results.cosines = results.arc_cosines = results.arc_tangents = angles;
+				fast_sin_cos(angles.data(), results.sines.data(), results.cosines.data(), angles.size());
+				fast_acos(coordinates.data(), results.arc_cosines.data(), coordinates.size());
+				fast_atan2(angles.data(), coordinates.data(), results.arc_tangents.data(), angles.size());
+
+				std::vector<float> perturbed = angles;
+				for (std::size_t i = 0; i < 19; i += 1)
+					perturbed[i] *= 1 + float(i % 4) * 1e-6f;
+
+				equivalent(angles.data(), perturbed.data(), results.equivalences, angles.size());
+				results.first_difference = find_equivalent(angles.data(), perturbed.data(), angles.size(), false);
+				results.first_equivalent = find_equivalent(angles.data() + 1, perturbed.data() + 1, angles.size() - 1, true);
+
+				return results;
+			}
+
+			// Evaluate the portable kernels using the generic templates, which they must match on every instruction set:
+			Results reference (const Results & results)
+			{
+				Mat44f a = rotate<Z>(R30) << translate(vector(1.0f, 2.0f, 3.0f)) << scale(vector(2.0f, 3.0f, 4.0f));
+				Mat44f b = perspective_projection_matrix<float>(R90, 1.0f, 0.1f, 100.0f);
+				Mat44d c = rotate<X>(R60) << translate(vector(-1.0, 0.5, 2.0));
+
+				Results expected = results;
+
+				expected.product = ZERO;
+				multiply<4, 4, 4, float>(expected.product, a, b);
+
+				expected.product_double = ZERO;
+				multiply<4, 4, 4, double>(expected.product_double, c, Mat44d(rotate<Y>(R45)));
+
+				expected.column = ZERO;
+				multiply<4, 4, float>(expected.column, a, vector(1.0f, 2.0f, 3.0f, 1.0f));
+
+				Mat44f left[5] = {a, b, a, b, a}, right[5] = {b, a, a, b, b};
+				for (std::size_t i = 0; i < 5; i += 1) {
+					expected.products[i] = ZERO;
+					multiply<4, 4, 4, float>(expected.products[i], left[i], right[i]);
+				}
+
+				Quaternion<float> q1(R30, vector(1.0f, 2.0f, 3.0f).normalize()), q2(R60, vector(0.0f, -1.0f, 1.0f).normalize());
+				expected.rotation = multiply<float>(q1, q2);
+
+				Quaternion<double> q3(R45, vector(0.0, 0.0, 1.0)), q4(R90, vector(1.0, 0.0, 0.0));
+				expected.rotation_double = multiply<double>(q3, q4);
+
+				for (std::size_t i = 0; i < 7; i += 1) {
+					expected.composed[i] = multiply<float>(Quaternion<float>(R30 * float(i), vector(0.0f, 1.0f, 0.0f)), Quaternion<float>(R45, vector(1.0f, 0.0f, float(i)).normalize()));
+					expected.composed_double[i] = multiply<double>(Quaternion<double>(R30 * double(i), vector(1.0, 0.0, 0.0)), Quaternion<double>(R60, vector(0.0, double(i), 1.0).normalize()));
+				}
+
+				for (std::size_t i = 0; i < 7; i += 1) {
+					for (auto mode : {QuaternionInterpolation::SPHERICAL, QuaternionInterpolation::NORMALIZED, QuaternionInterpolation::FAST_SPHERICAL})
+						expected.interpolated[std::size_t(mode)][i] = interpolate<float>(mode, float(i) / 6, Quaternion<float>(R30 * float(i), vector(0.0f, 1.0f, 0.0f)), Quaternion<float>(R45, vector(1.0f, 0.0f, float(i)).normalize()));
+				}
+
+				std::vector<Vec3f> input;
+				for (std::size_t i = 0; i < 19; i += 1)
+					input.push_back(vector(float(i), float(i) * 0.5f - 3.0f, 1.0f - float(i) * 0.25f));
+
+				transform_points<float>(a, input.data(), expected.points.data(), input.size());
+				transform_points_projective<float>(b, input.data(), expected.projected.data(), input.size());
+				transform_vectors<float>(a, input.data(), expected.vectors.data(), input.size());
+				rotate_vectors<float>(q1, input.data(), expected.rotated.data(), input.size());
+
+				skin_vertices<float>(palette, influences(input.size()).data(), input.data(), input.data(), sizeof(Vec3f), expected.skinned_positions.data(), expected.skinned_normals.data(), input.size());
+
+				std::vector<float> angles, coordinates;
+				for (std::size_t i = 0; i < 19; i += 1) {
+					angles.push_back(float(i) * 0.75f - 7.0f);
+					coordinates.push_back(float(i) / 9 - 1.0f);
+				}
+
+				fast_sin_cos<float>(angles.data(), expected.sines.data(), expected.cosines.data(), angles.size());
+				fast_acos<float>(coordinates.data(), expected.arc_cosines.data(), coordinates.size());
+				fast_atan2<float>(angles.data(), coordinates.data(), expected.arc_tangents.data(), angles.size());
+
+				std::vector<float> perturbed = angles;
+				for (std::size_t i = 0; i < 19; i += 1)
+					perturbed[i] *= 1 + float(i % 4) * 1e-6f;
+
+				equivalent<float>(angles.data(), perturbed.data(), expected.equivalences, angles.size());
+				expected.first_difference = find_equivalent<float>(angles.data(), perturbed.data(), angles.size(), false);
+				expected.first_equivalent = find_equivalent<float>(angles.data() + 1, perturbed.data() + 1, angles.size() - 1, true);
+
+				return expected;
+			}
+
+			template <typename VectorT>
+			bool equivalent (const std::vector<VectorT> & a, const std::vector<VectorT> & b)
+			{
+				for (std::size_t i = 0; i < a.size(); i += 1)
+					if (!a[i].equivalent(b[i])) return false;
+
+				return a.size() == b.size();
+			}
+
+			bool equivalent (const std::vector<float> & a, const std::vector<float> & b)
+			{
+				for (std::size_t i = 0; i < a.size(); i += 1)
+					if (!Numerics::equivalent(a[i], b[i])) return false;
+
+				return a.size() == b.size();
+			}
+
+			// Skinning blends and normalizes several transforms, so the kernels only match the generic templates to within a few ULP of the largest component:
+			template <typename VectorT>
+			bool nearby (const std::vector<VectorT> & a, const std::vector<VectorT> & b, float tolerance = 1e-5)
+			{
+				for (std::size_t i = 0; i < a.size(); i += 1)
+					if ((a[i] - b[i]).length() > tolerance * (1 + b[i].length())) return false;
+
+				return a.size() == b.size();
+			}
+		}
+
+		UnitTest::Suite InstructionsTestSuite {
+			"Euclid::Numerics::Instructions",
+
+			{"Selection",
+				[](UnitTest::Examiner & examiner) {
+					Instructions original = selected_instructions();
+
+					examiner << "Selected instructions are supported." << std::endl;
+					examiner.check(original <= supported_instructions());
+
+					examiner << "Generic instructions can always be selected." << std::endl;
+					examiner.check(select_instructions(Instructions::GENERIC) == Instructions::GENERIC);
+					examiner.check(selected_instructions() == Instructions::GENERIC);
+
+					examiner << "Unsupported instructions are clamped." << std::endl;
+					examiner.check(select_instructions(Instructions::AVX2) == supported_instructions());
+
+					select_instructions(original);
+				}
+			},
+
+			{"Kernels",
+				[](UnitTest::Examiner & examiner) {
+					Instructions original = selected_instructions();
+
+					select_instructions(Instructions::GENERIC);
+					Results expected = evaluate();
+
+					examiner << "Generic kernels match generic templates." << std::endl;
+					Results templates = reference(expected);
+					examiner.check(expected.product.equivalent(templates.product));
+					examiner.check(expected.product_double.equivalent(templates.product_double));
+					examiner.check(expected.column.equivalent(templates.column));
+
+					for (std::size_t i = 0; i < 5; i += 1)
+						examiner.check(expected.products[i].equivalent(templates.products[i]));
+
+					examiner.check(expected.rotation.equivalent(templates.rotation));
+					examiner.check(expected.rotation_double.equivalent(templates.rotation_double));
+					examiner.check(equivalent(expected.composed, templates.composed));
+					examiner.check(equivalent(expected.composed_double, templates.composed_double));
+
+					for (std::size_t i = 0; i < 3; i += 1)
+						examiner.check(equivalent(expected.interpolated[i], templates.interpolated[i]));
+
+					examiner.check(equivalent(expected.points, templates.points));
+					examiner.check(equivalent(expected.projected, templates.projected));
+					examiner.check(equivalent(expected.vectors, templates.vectors));
+					examiner.check(equivalent(expected.rotated, templates.rotated));
+					examiner.check(nearby(expected.skinned_positions, templates.skinned_positions));
+					examiner.check(nearby(expected.skinned_normals, templates.skinned_normals));
+					examiner.check(equivalent(expected.sines, templates.sines));
+					examiner.check(equivalent(expected.cosines, templates.cosines));
+					examiner.check(equivalent(expected.arc_cosines, templates.arc_cosines));
+					examiner.check(equivalent(expected.arc_tangents, templates.arc_tangents));
+					examiner.check(std::equal(expected.equivalences, expected.equivalences + 19, templates.equivalences));
+					examiner.check(expected.first_difference == templates.first_difference);
+					examiner.check(expected.first_equivalent == templates.first_equivalent);
+
+					for (auto instructions : {Instructions::SSE2, Instructions::AVX2}) {
+						if (instructions > supported_instructions()) continue;
+
+						select_instructions(instructions);
+						Results results = evaluate();
+
+						examiner << "Kernels for " << name(instructions) << " match generic implementation." << std::endl;
+						examiner.check(results.product.equivalent(expected.product));
+						examiner.check(results.product_double.equivalent(expected.product_double));
+						examiner.check(results.column.equivalent(expected.column));
+
+						for (std::size_t i = 0; i < 5; i += 1)
+							examiner.check(results.products[i].equivalent(expected.products[i]));
+
+						examiner.check(results.inverse.equivalent(expected.inverse));
+						examiner.check(results.inverse_affine.equivalent(expected.inverse_affine));
+						examiner.check(results.inverse_double.equivalent(expected.inverse_double));
+						examiner.check(results.affine_product.equivalent(expected.affine_product));
+						examiner.check(results.affine_inverse.equivalent(expected.affine_inverse));
+						examiner.check(results.rotation.equivalent(expected.rotation));
+						examiner.check(results.rotation_double.equivalent(expected.rotation_double));
+						examiner.check(equivalent(results.composed, expected.composed));
+						examiner.check(equivalent(results.composed_double, expected.composed_double));
+
+						for (std::size_t i = 0; i < 3; i += 1)
+							examiner.check(equivalent(results.interpolated[i], expected.interpolated[i]));
+
+						examiner.check(equivalent(results.points, expected.points));
+						examiner.check(equivalent(results.projected, expected.projected));
+						examiner.check(equivalent(results.vectors, expected.vectors));
+						examiner.check(equivalent(results.rotated, expected.rotated));
+						examiner.check(nearby(results.skinned_positions, expected.skinned_positions));
+						examiner.check(nearby(results.skinned_normals, expected.skinned_normals));
+						examiner.check(equivalent(results.normalized, expected.normalized));
+						examiner.check(equivalent(results.sines, expected.sines));
+						examiner.check(equivalent(results.cosines, expected.cosines));
+						examiner.check(equivalent(results.arc_cosines, expected.arc_cosines));
+						examiner.check(equivalent(results.arc_tangents, expected.arc_tangents));
+						examiner.check(std::equal(results.equivalences, results.equivalences + 19, expected.equivalences));
+						examiner.check(results.first_difference == expected.first_difference);
+						examiner.check(results.first_equivalent == expected.first_equivalent);
+					}
+
+					select_instructions(original);
+				}
+			},
+		};
+	}
+}
@@ -4,10 +4,16 @@
 #include <Euclid/Numerics/Matrix.hpp>
 #include <Euclid/Numerics/Matrix.Multiply.hpp>
 #include <Euclid/Numerics/Matrix.Inverse.hpp>
+#include <Euclid/Numerics/Matrix.Projections.hpp>
 #include <Euclid/Numerics/Matrix.IO.hpp>
 #include <Euclid/Numerics/Vector.IO.hpp>
 
 #include <Euclid/Numerics/Average.hpp>
+#include <Euclid/Numerics/Instructions.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <limits>
 
 namespace Euclid
 {
@@ -23,6 +29,31 @@ namespace Euclid
 					matrix.at(r, c) = i++;
 		}
 
+		/// Multiply matrices one element at a time. Used to check optimised implementations.
+		template <dimension R, dimension C, dimension T, typename NumericT>
+		Matrix<R, C, NumericT> reference_multiply (const Matrix<R, T, NumericT> & left, const Matrix<T, C, NumericT> & right) {
+			Matrix<R, C, NumericT> result(ZERO);
+
+			for (dimension r = 0; r < R; r += 1)
+				for (dimension c = 0; c < C; c += 1)
+					for (dimension t = 0; t < T; t += 1)
+						result.at(r, c) += left.at(r, t) * right.at(t, c);
+
+			return result;
+		}
+
+		/// Multiply a matrix by a homogeneous vector one element at a time. Used to check optimised implementations.
+		template <dimension R, dimension C, typename NumericT>
+		Vector<R, NumericT> reference_multiply (const Matrix<R, C, NumericT> & left, const Vector<C, NumericT> & right) {
+			Vector<R, NumericT> result(ZERO);
+
+			for (dimension r = 0; r < R; r += 1)
+				for (dimension c = 0; c < C; c += 1)
+					result[r] += left.at(r, c) * right[c];
+
+			return result;
+		}
+
 		UnitTest::Suite MatrixTestSuite {
 			"Euclid::Numerics::Matrix",
 
@@ -215,6 +246,201 @@ namespace Euclid
 				}
 			},
 
+			{"Fused Transforms",
+				[](UnitTest::Examiner & examiner) {
+					auto t = translate(vector<RealT>(1, 2, 3));
+					auto u = translate(vector<RealT>(-4, 0, 2));
+					auto s = scale(vector<RealT>(2, 3, 4));
+					auto x = rotate<X>(R30);
+					auto y = rotate<Y>(R60);
+					auto a = rotate(R45, vector<RealT>(0, 1, 0));
+					Quat q1 = rotate<Z>(R10), q2 = rotate<X>(R90);
+
+					Mat44 fused = t << u << x << x << y << s << s << scale(RealT(2)) << a << q1 << q2 << translate(vector<RealT>(0, 0, 0));
+
+					Mat44 reference = IDENTITY;
+					for (Mat44 step : {Mat44(t), Mat44(u), Mat44(x), Mat44(x), Mat44(y), Mat44(s), Mat44(s), Mat44(scale(RealT(2))), Mat44(a), Mat44(q1), Mat44(q2)})
+						reference = reference_multiply(reference, step);
+
+					examiner << "Fused transform chain matches multiplying each transform." << std::endl;
+					examiner.check(fused.equivalent(reference));
+
+					examiner << "Identity transforms are skipped." << std::endl;
+					examiner.check(translate(vector<RealT>(0, 0, 0)).identity());
+					examiner.check(!translate(vector<RealT>(1, 0, 0)).identity());
+					examiner.check(scale(vector<RealT>(1, 1, 1)).identity());
+					examiner.check(Mat44(rotate<Z>(R0) << scale(vector<RealT>(1, 1, 1))).equivalent(IDENTITY));
+				}
+			},
+
+			{"Multiplication",
+				[](UnitTest::Examiner & examiner) {
+					Matrix<4, 4, float> a, b;
+					load_test_pattern(a);
+					b = rotate<Y>(R30) << translate(vector(1.0f, 2.0f, 3.0f)) << scale(vector(2.0f, 3.0f, 4.0f));
+
+					examiner << "Single precision multiplication is correct." << std::endl;
+					examiner.check((a * b).equivalent(reference_multiply(a, b)));
+
+					Matrix<4, 4, double> c, d;
+					load_test_pattern(c);
+					d = rotate<Z>(R60) << translate(vector(-1.0, 2.0, 0.5));
+
+					examiner << "Double precision multiplication is correct." << std::endl;
+					examiner.check((c * d).equivalent(reference_multiply(c, d)));
+					examiner.check((d * c).equivalent(reference_multiply(d, c)));
+				}
+			},
+
+			{"Batch Multiplication",
+				[](UnitTest::Examiner & examiner) {
+					// An odd number of matrices so that the last one is not part of a pair:
+					std::vector<Mat44> left(5), right(5), result(5);
+
+					for (std::size_t i = 0; i < left.size(); i += 1) {
+						load_test_pattern(left[i]);
+						right[i] = rotate<X>(R10 * i) << translate(vector<RealT>(i, 1, 2));
+					}
+
+					multiply(result.data(), left.data(), right.data(), result.size());
+
+					for (std::size_t i = 0; i < result.size(); i += 1) {
+						examiner << "Matrix " << i << " of batch is correct." << std::endl;
+						examiner.check(result[i].equivalent(reference_multiply(left[i], right[i])));
+					}
+				}
+			},
+
+			{"Multiplication Performance",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t COUNT = 1024, PASSES = 200;
+
+					auto measure = [&](auto zero) {
+						typedef decltype(zero) NumericT;
+						typedef Matrix<4, 4, NumericT> MatrixT;
+
+						std::vector<MatrixT> left(COUNT), right(COUNT), expected(COUNT), result(COUNT);
+
+						for (std::size_t i = 0; i < COUNT; i += 1) {
+							load_test_pattern(left[i]);
+							right[i] = rotate<Y>(R10 * NumericT(i % 36)) << translate(vector<NumericT>(NumericT(i % 7), 1, 2));
+						}
+
+						// The generic template, which is what every multiplication used before the kernels were added:
+						double generic = Benchmark::nanoseconds_per_item(COUNT, PASSES, [&]{
+							for (std::size_t i = 0; i < COUNT; i += 1) {
+								expected[i] = ZERO;
+								multiply<4, 4, 4, NumericT>(expected[i], left[i], right[i]);
+							}
+						});
+
+						double single = Benchmark::nanoseconds_per_item(COUNT, PASSES, [&]{
+							for (std::size_t i = 0; i < COUNT; i += 1) {
+								result[i] = ZERO;
+								multiply(result[i], left[i], right[i]);
+							}
+						});
+
+						// Fused multiply-add rounds differently, so entries which cancel to nearly zero can't be compared with equivalent:
+						auto close = [&]() {
+							bool close = true;
+
+							for (std::size_t i = 0; i < COUNT; i += 1) {
+								NumericT magnitude = 0;
+
+								for (dimension r = 0; r < 4; r += 1)
+									for (dimension c = 0; c < 4; c += 1)
+										magnitude = std::max(magnitude, std::abs(expected[i].at(r, c)));
+
+								for (dimension r = 0; r < 4; r += 1)
+									for (dimension c = 0; c < 4; c += 1)
+										close = close && std::abs(result[i].at(r, c) - expected[i].at(r, c)) <= magnitude * std::numeric_limits<NumericT>::epsilon() * 16;
+							}
+
+							return close;
+						};
+
+						bool correct = close();
+
+						double batch = Benchmark::nanoseconds_per_item(COUNT, PASSES, [&]{
+							multiply(result.data(), left.data(), right.data(), COUNT);
+						});
+
+						correct = correct && close();
+
+						examiner << (sizeof(NumericT) == 4 ? "float" : "double") << " took " << generic << "ns generic, " << single << "ns specialized and " << batch << "ns batched per multiplication" << std::endl;
+						examiner.check(correct);
+					};
+
+					Instructions original = selected_instructions();
+
+					for (auto instructions : {Instructions::GENERIC, Instructions::SSE2, Instructions::AVX2}) {
+						if (instructions > supported_instructions()) continue;
+
+						select_instructions(instructions);
+						examiner << "Using " << name(instructions) << ":" << std::endl;
+
+						measure(0.0f);
+						measure(0.0);
+					}
+
+					select_instructions(original);
+				}
+			},
+
+			{"Vector Multiplication",
+				[](UnitTest::Examiner & examiner) {
+					Matrix<4, 4, float> a;
+					load_test_pattern(a);
+					Vector<4, float> u = {1.0f, -2.0f, 0.5f, 3.0f};
+
+					examiner << "Single precision vector multiplication is correct." << std::endl;
+					examiner.check((a * u).equivalent(reference_multiply(a, u)));
+
+					Matrix<4, 4, double> b;
+					load_test_pattern(b);
+					Vector<4, double> v = {1.0, -2.0, 0.5, 3.0};
+
+					examiner << "Double precision vector multiplication is correct." << std::endl;
+					examiner.check((b * v).equivalent(reference_multiply(b, v)));
+				}
+			},
+
+			{"Batch Transformation",
+				[](UnitTest::Examiner & examiner) {
+					Mat44 transform = rotate<Y>(R30) << translate(vector<RealT>(1, 2, 3)) << scale(vector<RealT>(2, 3, 4));
+					Mat44 projection = perspective_projection_matrix<RealT>(R90, 1, 1, 100) << transform;
+
+					// Not a multiple of the SIMD width, so that the remainder is also processed:
+					std::vector<Vec3> input(11), points(11), projected(11), vectors(11);
+
+					for (std::size_t i = 0; i < input.size(); i += 1)
+						input[i] = {RealT(i), RealT(i) * 2 - 5, RealT(i) * -3 - 1};
+
+					transform_points(transform, input.data(), points.data(), input.size());
+					transform_points_projective(projection, input.data(), projected.data(), input.size());
+					transform_vectors(transform, input.data(), vectors.data(), input.size());
+
+					for (std::size_t i = 0; i < input.size(); i += 1) {
+						Vec4 point = reference_multiply(transform, input[i] << 1);
+						Vec4 projected_point = reference_multiply(projection, input[i] << 1);
+						Vec4 vector = reference_multiply(transform, input[i] << 0);
+
+						examiner << "Point " << i << " of batch is correct." << std::endl;
+						examiner.check(points[i].equivalent(point.reduce()));
+						examiner.check(projected[i].equivalent((projected_point / projected_point[W]).reduce()));
+						examiner.check(vectors[i].equivalent(vector.reduce()));
+					}
+
+					// The output may be the same array as the input:
+					transform_points(transform, input.data(), input.data(), input.size());
+
+					examiner << "Points can be transformed in place." << std::endl;
+					for (std::size_t i = 0; i < input.size(); i += 1)
+						examiner.check(input[i].equivalent(points[i]));
+				}
+			},
+
 			{"Inverse",
 				[](UnitTest::Examiner & examiner) {
 					Mat44 m1 = rotate<X>(R90);
@@ -225,6 +451,65 @@ namespace Euclid
 				}
 			},
 
+			{"Projective Inverse",
+				[](UnitTest::Examiner & examiner) {
+					Matrix<4, 4, float> a = perspective_projection_matrix<float>(R90, 1.5f, 1, 100) << rotate<Y>(R30) << translate(vector(1.0f, 2.0f, 3.0f));
+					Matrix<4, 4, float> a_reference;
+					invert_matrix_4x4(a.data(), a_reference.data());
+
+					examiner << "Single precision inverse is correct." << std::endl;
+					examiner.check(inverse(a).equivalent(a_reference));
+					examiner.check((a * inverse(a)).equivalent(IDENTITY));
+
+					Matrix<4, 4, double> b = perspective_projection_matrix<double>(R60, 0.75, 0.5, 10) << rotate<X>(R45) << scale(vector(2.0, 3.0, 4.0));
+					Matrix<4, 4, double> b_reference;
+					invert_matrix_4x4(b.data(), b_reference.data());
+
+					examiner << "Double precision inverse is correct." << std::endl;
+					examiner.check(inverse(b).equivalent(b_reference));
+					examiner.check((b * inverse(b)).equivalent(IDENTITY));
+				}
+			},
+
+			{"Affine Inverse",
+				[](UnitTest::Examiner & examiner) {
+					Matrix<4, 4, float> a = rotate<Y>(R30) << translate(vector(1.0f, 2.0f, 3.0f)) << scale(vector(2.0f, 3.0f, 4.0f));
+
+					examiner << "Single precision affine inverse matches general inverse." << std::endl;
+					examiner.check(inverse_affine(a).equivalent(inverse(a)));
+
+					Matrix<4, 4, double> b = translate(vector(-1.0, 0.5, 8.0)) << rotate<Z>(R60) << scale(vector(0.5, 0.5, 2.0));
+
+					examiner << "Double precision affine inverse matches general inverse." << std::endl;
+					examiner.check(inverse_affine(b).equivalent(inverse(b)));
+				}
+			},
+
+			{"Batch Inverse",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<Mat44> source(5), result(5), affine(5);
+
+					for (std::size_t i = 0; i < source.size(); i += 1)
+						source[i] = rotate<X>(R10 * i) << translate(vector<RealT>(i, 1, 2)) << scale(vector<RealT>(1, i + 1, 2));
+
+					inverse(result.data(), source.data(), source.size());
+					inverse_affine(affine.data(), source.data(), source.size());
+
+					for (std::size_t i = 0; i < source.size(); i += 1) {
+						examiner << "Matrix " << i << " of batch is inverted." << std::endl;
+						examiner.check((source[i] * result[i]).equivalent(IDENTITY));
+						examiner.check(affine[i].equivalent(result[i]));
+					}
+
+					// The result may be the same array as the source:
+					inverse_affine(source.data(), source.data(), source.size());
+
+					examiner << "Matrices can be inverted in place." << std::endl;
+					for (std::size_t i = 0; i < source.size(); i += 1)
+						examiner.check(source[i].equivalent(affine[i]));
+				}
+			},
+
 			{"Eigenvalues",
 				[](UnitTest::Examiner & examiner) {
 					using namespace Euclid::Numerics;
@@ -0,0 +1,199 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/PerlinNoise.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			// The number of times each benchmark is repeated:
+			const std::size_t PASSES = 10;
+
+			// The largest difference between the grid and the scalar function evaluated at each point of the grid:
+			template <typename FunctionT>
+			RealT grid_error (const std::vector<RealT> & grid, const Vec3 & origin, const Vec3 & step, const Vector<3, std::size_t> & dimensions, FunctionT function)
+			{
+				RealT error = 0;
+				std::size_t i = 0;
+
+				for (std::size_t z = 0; z < dimensions[Z]; z += 1)
+					for (std::size_t y = 0; y < dimensions[Y]; y += 1)
+						for (std::size_t x = 0; x < dimensions[X]; x += 1)
+							error = std::max(error, std::abs(grid[i++] - function(origin + step * Vec3(x, y, z))));
+
+				return error;
+			}
+		}
+
+		UnitTest::Suite PerlinNoiseTestSuite {
+			"Euclid::Numerics::PerlinNoise",
+
+			{"Sample",
+				[](UnitTest::Examiner & examiner) {
+					PerlinNoise noise(42);
+
+					examiner << "Noise is the same for the same seed" << std::endl;
+					examiner.check_equal(noise.sample(Vec3(1.5, 2.25, 3.75)), PerlinNoise(42).sample(Vec3(1.5, 2.25, 3.75)));
+
+					examiner << "Noise is in the range [0, 1]" << std::endl;
+					bool bounded = true;
+					for (RealT x = -20; x < 20; x += 0.37)
+						bounded = bounded && noise.sample(Vec3(x, x * 0.5, 1 - x)) >= 0 && noise.sample(Vec3(x, x * 0.5, 1 - x)) <= 1;
+					examiner.check(bounded);
+
+					examiner << "Noise is continuous across lattice cells" << std::endl;
+					examiner.check(std::abs(noise.sample(Vec3(1.9999, 0.5, 0.5)) - noise.sample(Vec3(2.0001, 0.5, 0.5))) < 1e-3);
+					examiner.check(std::abs(noise.sample(Vec3(-0.0001, 0.5, 0.5)) - noise.sample(Vec3(0.0001, 0.5, 0.5))) < 1e-3);
+				}
+			},
+
+			{"Sample Grid",
+				[](UnitTest::Examiner & examiner) {
+					PerlinNoise noise(7);
+
+					// The width isn't a multiple of the packet width, and the grid crosses zero:
+					Vec3 origin(-3.1, -2.6, -1.3), step(0.13, 0.21, 0.37);
+					Vector<3, std::size_t> dimensions(37, 11, 5);
+
+					std::vector<RealT> grid(dimensions[X] * dimensions[Y] * dimensions[Z]);
+					noise.sample_grid(origin, step, dimensions, grid.data());
+
+					RealT error = grid_error(grid, origin, step, dimensions, [&](const Vec3 & at){return noise.sample(at);});
+
+					examiner << "The grid is the same as sampling each point, with error " << error << std::endl;
+					examiner.check(error < 1e-6);
+
+					examiner << "Rows which span more cells than the permutation table are sampled correctly" << std::endl;
+					Vec3 wide_step(-7.3, 1, 1);
+					Vector<3, std::size_t> wide_dimensions(100, 2, 1);
+					std::vector<RealT> wide(wide_dimensions[X] * wide_dimensions[Y]);
+					noise.sample_grid(origin, wide_step, wide_dimensions, wide.data());
+					RealT wide_error = grid_error(wide, origin, wide_step, wide_dimensions, [&](const Vec3 & at){return noise.sample(at);});
+
+					// The points are far from the origin, so the positions may be rounded differently, e.g. by a fused multiply-add:
+					examiner << "The error of the wide grid is " << wide_error << std::endl;
+					examiner.check(wide_error < 1e-4);
+
+					examiner << "A 2D grid is a single slice" << std::endl;
+					std::vector<RealT> slice(dimensions[X] * dimensions[Y]);
+					noise.sample_grid(origin + Vec3(0, 0, step[Z] * 2), Vec3(step[X], step[Y], 0), Vector<3, std::size_t>(dimensions[X], dimensions[Y], 1), slice.data());
+					examiner.check(std::equal(slice.begin(), slice.end(), grid.begin() + 2 * slice.size()));
+				}
+			},
+
+			{"Turbulence Grid",
+				[](UnitTest::Examiner & examiner) {
+					PerlinNoise noise(11);
+
+					Vec3 origin(-100, 50, 3), step(1.5, 0.75, 0);
+					Vector<3, std::size_t> dimensions(255, 255, 1);
+
+					std::vector<RealT> grid(dimensions[X] * dimensions[Y] * dimensions[Z]);
+					noise.turbulence_grid(origin, step, dimensions, grid.data());
+
+					RealT error = grid_error(grid, origin, step, dimensions, [&](const Vec3 & at){return noise.turbulence(at);});
+
+					examiner << "The grid is the same as the turbulence at each point, with error " << error << std::endl;
+					examiner.check(error < 1e-6);
+
+					std::vector<RealT> reference(grid.size());
+
+					double scalar = Benchmark::nanoseconds_per_item(grid.size(), PASSES, [&]{
+						std::size_t i = 0;
+
+						for (std::size_t y = 0; y < dimensions[Y]; y += 1)
+							for (std::size_t x = 0; x < dimensions[X]; x += 1)
+								reference[i++] = noise.turbulence(origin + step * Vec3(x, y, 0));
+					});
+
+					double batch = Benchmark::nanoseconds_per_item(grid.size(), PASSES, [&]{
+						noise.turbulence_grid(origin, step, dimensions, grid.data());
+					});
+
+					examiner << "turbulence took " << scalar << "ns, turbulence_grid took " << batch << "ns per sample" << std::endl;
+				}
+			},
+
+			{"Marble",
+				[](UnitTest::Examiner & examiner) {
+					PerlinNoise noise(5);
+
+					examiner << "Marble is in the range [0, 1], and depends on the strength" << std::endl;
+					bool bounded = true, distorted = false;
+					for (RealT x = -20; x < 20; x += 0.37) {
+						Vec3 at(x, x * 0.5, 1 - x);
+						RealT value = noise.marble(4, at);
+
+						bounded = bounded && value >= 0 && value <= 1;
+						distorted = distorted || value != noise.marble(0, at);
+					}
+					examiner.check(bounded);
+					examiner.check(distorted);
+
+					Vec3 origin(-12, 7, 0.5), step(0.35, 0.6, 0.9);
+					Vector<3, std::size_t> dimensions(300, 40, 2);
+
+					std::vector<RealT> grid(dimensions[X] * dimensions[Y] * dimensions[Z]), tiled(grid.size());
+					noise.marble_grid(4, origin, step, dimensions, grid.data());
+
+					RealT error = grid_error(grid, origin, step, dimensions, [&](const Vec3 & at){return noise.marble(4, at);});
+
+					examiner << "The grid is the same as the marble at each point, with error " << error << std::endl;
+					examiner.check(error < 1e-5);
+
+					examiner << "The tiles are identical to the grid" << std::endl;
+					noise.marble_tiled(4, origin, step, dimensions, tiled.data(), 3);
+					examiner.check(tiled == grid);
+				}
+			},
+
+			{"Tiled",
+				[](UnitTest::Examiner & examiner) {
+					PerlinNoise noise(3);
+
+					// The dimensions are not multiples of the tiles:
+					Vec3 origin(-40, 12, 0.5), step(0.7, 0.3, 1.1);
+					Vector<3, std::size_t> dimensions(300, 70, 3);
+
+					std::vector<RealT> expected(dimensions[X] * dimensions[Y] * dimensions[Z]), tiled(expected.size());
+					noise.turbulence_grid(origin, step, dimensions, expected.data());
+
+					examiner << "The tiles are identical to the grid for any number of threads" << std::endl;
+					for (std::size_t threads : {1, 2, 3, 8, 0}) {
+						std::fill(tiled.begin(), tiled.end(), -1);
+						noise.turbulence_tiled(origin, step, dimensions, tiled.data(), threads);
+
+						examiner.check(tiled == expected);
+					}
+
+					noise.sample_grid(origin, step, dimensions, expected.data());
+					noise.sample_tiled(origin, step, dimensions, tiled.data(), 4);
+					examiner.check(tiled == expected);
+
+					examiner << "Empty grids are ignored" << std::endl;
+					noise.sample_tiled(origin, step, Vector<3, std::size_t>(0, 10, 10), nullptr);
+
+					Vector<3, std::size_t> terrain(1024, 1024, 1);
+					std::vector<RealT> heights(terrain[X] * terrain[Y]);
+
+					double single = Benchmark::nanoseconds_per_item(heights.size(), PASSES, [&]{
+						noise.turbulence_tiled(origin, Vec3(0.25, 0.25, 0), terrain, heights.data(), 1);
+					});
+
+					double concurrent = Benchmark::nanoseconds_per_item(heights.size(), PASSES, [&]{
+						noise.turbulence_tiled(origin, Vec3(0.25, 0.25, 0), terrain, heights.data());
+					});
+
+					examiner << "turbulence_tiled took " << single << "ns per sample on one thread, and " << concurrent << "ns on " << std::thread::hardware_concurrency() << " threads" << std::endl;
+				}
+			},
+		};
+	}
+}
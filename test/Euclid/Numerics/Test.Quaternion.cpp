@@ -5,11 +5,30 @@
 #include <Euclid/Numerics/Transforms.hpp>
 #include <Euclid/Numerics/Quaternion.Multiply.hpp>
 #include <Euclid/Numerics/Matrix.Multiply.hpp>
+#include <Euclid/Numerics/Quaternion.Interpolate.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <vector>
 
 namespace Euclid
 {
 	namespace Numerics
 	{
+		namespace
+		{
+			// The largest distance between corresponding rotations, given that q and -q represent the same rotation:
+			RealT maximum_error (const std::vector<Quat> & a, const std::vector<Quat> & b)
+			{
+				RealT error = 0;
+
+				for (std::size_t i = 0; i < a.size(); i += 1)
+					error = std::max<RealT>(error, std::min<RealT>((Vec4(a[i]) - Vec4(b[i])).length(), (Vec4(a[i]) + Vec4(b[i])).length()));
+
+				return error;
+			}
+		}
+
 		UnitTest::Suite QuaternionTestSuite {
 			"Euclid::Numerics::Quaternion",
 
@@ -104,6 +123,104 @@ namespace Euclid
 					examiner.check(q3.equivalent(Quat(IDENTITY)));
 				}
 			},
+
+			{"Batch Rotation",
+				[](UnitTest::Examiner & examiner) {
+					Quat q(R60, Vec3(1, 2, 3).normalize());
+					Mat44 m = q;
+
+					examiner << "Rotating a vector is the same as the rotation matrix" << std::endl;
+					examiner.check(rotate(q, Vec3(15.0, -12.5, 4.0)).equivalent(m * Vec3(15.0, -12.5, 4.0)));
+
+					Vec3 vectors[11];
+					for (std::size_t i = 0; i < 11; i += 1)
+						vectors[i] = {RealT(i), 1 - RealT(i), RealT(i) * 2};
+
+					Vec3 rotated[11];
+					rotate_vectors(q, vectors, rotated, 11);
+
+					examiner << "Rotated vectors are correct" << std::endl;
+					for (std::size_t i = 0; i < 11; i += 1)
+						examiner.check(rotated[i].equivalent(m * vectors[i]));
+
+					Quat left[5], right[5], composed[5];
+					for (std::size_t i = 0; i < 5; i += 1) {
+						left[i] = Quat(R30 * RealT(i), Vec3(0, 1, 0));
+						right[i] = Quat(R45, Vec3(1, 0, RealT(i)).normalize());
+					}
+
+					compose_quaternions(left, right, composed, 5);
+
+					examiner << "Composed quaternions are correct" << std::endl;
+					for (std::size_t i = 0; i < 5; i += 1)
+						examiner.check(composed[i].equivalent(left[i] * right[i]));
+				}
+			},
+
+			{"Interpolation",
+				[](UnitTest::Examiner & examiner) {
+					Quat a = rotate<Z>(R30), b = rotate<Z>(R90);
+
+					examiner << "Spherical interpolation is at constant angular velocity" << std::endl;
+					examiner.check(Quat(spherical_linear_interpolate<RealT>(0.25, a, b)).equivalent(Quat(rotate<Z>(R45))));
+					examiner.check(Quat(spherical_linear_interpolate<RealT>(0.0, a, b)).equivalent(a));
+					examiner.check(Quat(spherical_linear_interpolate<RealT>(1.0, a, b)).equivalent(b));
+
+					examiner << "Interpolation follows the shortest path" << std::endl;
+					examiner.check(Quat(spherical_linear_interpolate<RealT>(0.25, a, -Vec4(b))).equivalent(Quat(rotate<Z>(R45))));
+
+					examiner << "Normalized interpolation is halfway at the midpoint" << std::endl;
+					examiner.check(Quat(normalized_linear_interpolate<RealT>(0.5, a, b)).equivalent(Quat(rotate<Z>(R60))));
+
+					examiner << "Fast interpolation is close to spherical interpolation" << std::endl;
+					examiner.check((fast_spherical_linear_interpolate<RealT>(0.25, a, b) - spherical_linear_interpolate<RealT>(0.25, a, b)).length() < RealT(1e-4));
+				}
+			},
+
+			{"Batch Interpolation",
+				[](UnitTest::Examiner & examiner) {
+					const std::size_t COUNT = 4099, PASSES = 100;
+
+					std::vector<Quat> from, to, exact(COUNT), output(COUNT);
+					std::vector<RealT> factors;
+
+					for (std::size_t i = 0; i < COUNT; i += 1) {
+						from.push_back(Quat(R30 * RealT(i % 7), Vec3(1, RealT(i % 5), 2).normalize()));
+
+						// The rotations between the pairs are up to 150 degrees, and every other pair is in the opposite hemisphere:
+						Quat delta(R30 * RealT(i % 6), Vec3(RealT(i % 3), -1, 1).normalize());
+						to.push_back(Vec4(from.back() * delta) * RealT(i % 2 ? -1 : 1));
+						factors.push_back(RealT(i % 101) / 100);
+					}
+
+					for (std::size_t i = 0; i < COUNT; i += 1)
+						exact[i] = spherical_linear_interpolate(factors[i], from[i], to[i]);
+
+					struct Mode {
+						QuaternionInterpolation mode;
+						const char * name;
+						RealT tolerance;
+					};
+
+					// The normalized linear interpolation is not at constant angular velocity, so its deviation from the spherical interpolation depends on the angle between the inputs.
+					for (auto mode : {Mode{QuaternionInterpolation::SPHERICAL, "spherical", 1e-5}, Mode{QuaternionInterpolation::NORMALIZED, "normalized", 0.05}, Mode{QuaternionInterpolation::FAST_SPHERICAL, "fast spherical", 1e-4}}) {
+						double duration = Benchmark::nanoseconds_per_item(COUNT, PASSES, [&]{
+							interpolate_quaternions(mode.mode, from.data(), to.data(), factors.data(), output.data(), COUNT);
+						});
+
+						RealT error = maximum_error(output, exact);
+
+						examiner << "Interpolation using " << mode.name << " took " << duration << "ns per quaternion with maximum error " << error << std::endl;
+						examiner.check(error < mode.tolerance);
+					}
+
+					interpolate_quaternions(QuaternionInterpolation::SPHERICAL, from.data(), to.data(), RealT(0.5), output.data(), COUNT);
+
+					examiner << "Interpolation with a single factor is correct" << std::endl;
+					for (std::size_t i = 0; i < COUNT; i += 1)
+						examiner.check(output[i].equivalent(spherical_linear_interpolate<RealT>(0.5, from[i], to[i])));
+				}
+			},
 		};
 	}
 }
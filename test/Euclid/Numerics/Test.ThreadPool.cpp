@@ -0,0 +1,141 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/ThreadPool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		UnitTest::Suite ThreadPoolTestSuite {
+			"Euclid::Numerics::ThreadPool",
+
+			{"Running Tasks",
+				[](UnitTest::Examiner & examiner) {
+					ThreadPool pool(3);
+					examiner.check_equal(pool.size(), 4);
+
+					examiner << "Every task is run once, for any number of threads" << std::endl;
+					for (std::size_t threads : {0, 1, 2, 4, 16}) {
+						std::vector<std::atomic<std::size_t>> counts(1000);
+
+						pool.run(counts.size(), threads, [&](std::size_t index) {counts[index] += 1;});
+
+						bool once = true;
+						for (auto & count : counts)
+							once = once && count == 1;
+						examiner.check(once);
+					}
+
+					examiner << "The number of threads is limited" << std::endl;
+					std::mutex mutex;
+					std::set<std::thread::id> ids;
+					pool.run(1000, 2, [&](std::size_t) {
+						std::lock_guard<std::mutex> lock(mutex);
+						ids.insert(std::this_thread::get_id());
+					});
+					examiner.check(ids.size() <= 2);
+
+					examiner << "A task can run another job, which is run on its thread" << std::endl;
+					std::atomic<std::size_t> nested(0);
+					pool.run(8, 0, [&](std::size_t) {
+						pool.run(10, 0, [&](std::size_t) {nested += 1;});
+					});
+					examiner.check_equal(nested.load(), 80);
+
+					examiner << "Jobs can be run from several threads at once" << std::endl;
+					std::atomic<std::size_t> total(0);
+					std::vector<std::thread> callers;
+					for (std::size_t i = 0; i < 4; i += 1)
+						callers.emplace_back([&]{
+							for (std::size_t j = 0; j < 50; j += 1)
+								pool.run(100, 0, [&](std::size_t) {total += 1;});
+						});
+					for (auto & caller : callers)
+						caller.join();
+					examiner.check_equal(total.load(), 4 * 50 * 100);
+
+					examiner << "An exception thrown by a task is rethrown once the other tasks have finished" << std::endl;
+					for (std::size_t failing : {0, 1, 500}) {
+						std::atomic<std::size_t> running(0), finished(0);
+						bool thrown = false;
+
+						try {
+							pool.run(1000, 0, [&](std::size_t index) {
+								running += 1;
+
+								if (index == failing)
+									throw std::runtime_error("task failed");
+
+								std::this_thread::sleep_for(std::chrono::microseconds(10));
+
+								finished += 1;
+								running -= 1;
+							});
+						} catch (const std::runtime_error &) {
+							thrown = true;
+						}
+
+						examiner.check(thrown);
+
+						// Only the failing task is still counted as running:
+						examiner.check_equal(running.load(), 1);
+						examiner.check(finished.load() < 999);
+					}
+
+					examiner << "The pool can be used after a task has thrown" << std::endl;
+					std::atomic<std::size_t> after(0);
+					pool.run(100, 0, [&](std::size_t) {after += 1;});
+					examiner.check_equal(after.load(), 100);
+
+					examiner << "A pool without workers runs on the calling thread" << std::endl;
+					ThreadPool serial(0);
+					std::thread::id caller = std::this_thread::get_id();
+					bool calling = true;
+					serial.run(10, 0, [&](std::size_t) {calling = calling && std::this_thread::get_id() == caller;});
+					examiner.check(calling);
+				}
+			},
+
+			{"Parallel Ranges",
+				[](UnitTest::Examiner & examiner) {
+					examiner << "The number of threads gives each thread a minimum range" << std::endl;
+					examiner.check_equal(thread_count(100, 8), 1);
+					examiner.check_equal(thread_count(MINIMUM_PARALLEL_RANGE * 3, 8), 3);
+					examiner.check_equal(thread_count(MINIMUM_PARALLEL_RANGE * 100, 8), 8);
+					examiner.check_equal(thread_count(100, 8, 10), 8);
+
+					examiner << "The ranges cover every index once, and are aligned" << std::endl;
+					const std::size_t COUNT = MINIMUM_PARALLEL_RANGE * 4 + 3;
+					std::vector<std::atomic<std::size_t>> counts(COUNT);
+					std::atomic<bool> aligned(true);
+
+					parallel_ranges(COUNT, 4, [&](std::size_t begin, std::size_t end) {
+						if (begin % 8 != 0 || (end != COUNT && end % 8 != 0)) aligned = false;
+
+						for (std::size_t i = begin; i < end; i += 1)
+							counts[i] += 1;
+					}, 8);
+
+					bool once = true;
+					for (auto & count : counts)
+						once = once && count == 1;
+					examiner.check(once);
+					examiner.check(aligned.load());
+
+					examiner << "Empty ranges are ignored" << std::endl;
+					bool called = false;
+					parallel_ranges(0, 4, [&](std::size_t, std::size_t) {called = true;});
+					examiner.check(!called);
+				}
+			},
+		};
+	}
+}
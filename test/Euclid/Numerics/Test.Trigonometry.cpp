@@ -0,0 +1,208 @@
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/Trigonometry.hpp>
+#include <Euclid/Numerics/Angle.hpp>
+#include <Euclid/Numerics/Number.hpp>
+
+#include "../Benchmark.hpp"
+
+#include <vector>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		namespace
+		{
+			// The number of times each benchmark is repeated:
+			const std::size_t PASSES = 100;
+
+			// The distance in ULP between an approximation and the correctly rounded result:
+			std::size_t ulp (float approximation, double exact)
+			{
+				return FloatEquivalenceTraits<float>::integral_difference(approximation, float(exact));
+			}
+
+			struct Errors {
+				std::size_t ulp = 0;
+				double absolute = 0;
+
+				void add (float approximation, double exact)
+				{
+					absolute = std::max(absolute, std::abs(approximation - exact));
+
+					// The relative error is unbounded near the roots, where the absolute error is used instead:
+					if (std::abs(exact) > 1e-3)
+						ulp = std::max(ulp, Numerics::ulp(approximation, exact));
+				}
+			};
+		}
+
+		UnitTest::Suite TrigonometryTestSuite {
+			"Euclid::Numerics::Trigonometry",
+
+			{"Sine and Cosine",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<float> angles, sines, cosines;
+
+					for (float angle = -8192; angle <= 8192; angle += 0.001f * std::max(std::abs(angle), 1.0f))
+						angles.push_back(angle);
+
+					sines.resize(angles.size());
+					cosines.resize(angles.size());
+
+					fast_sin_cos(angles.data(), sines.data(), cosines.data(), angles.size());
+
+					Errors scalar, batch;
+
+					for (std::size_t i = 0; i < angles.size(); i += 1) {
+						float sine, cosine;
+						fast_sin_cos(angles[i], sine, cosine);
+
+						scalar.add(sine, std::sin(double(angles[i])));
+						scalar.add(cosine, std::cos(double(angles[i])));
+						batch.add(sines[i], std::sin(double(angles[i])));
+						batch.add(cosines[i], std::cos(double(angles[i])));
+					}
+
+					examiner << "Scalar error is " << scalar.ulp << " ULP, " << scalar.absolute << " absolute" << std::endl;
+					examiner.check(scalar.ulp <= 2);
+					examiner.check(scalar.absolute < 1e-7);
+
+					examiner << "Batch error is " << batch.ulp << " ULP, " << batch.absolute << " absolute" << std::endl;
+					examiner.check(batch.ulp <= 2);
+					examiner.check(batch.absolute < 1e-7);
+
+					examiner << "Quadrants are selected correctly" << std::endl;
+					examiner.check(fast_sin(0.0f) == 0);
+					examiner.check(fast_cos(0.0f) == 1);
+					examiner.check(number(fast_sin(float(M_PI_2))).equivalent(1));
+					examiner.check(number(fast_cos(float(M_PI))).equivalent(-1));
+					examiner.check(number(fast_sin(float(-M_PI_2))).equivalent(-1));
+					examiner.check(number(fast_tan(float(M_PI_4))).equivalent(1));
+
+					std::vector<float> reference_sines(angles.size()), reference_cosines(angles.size());
+
+					double standard = Benchmark::nanoseconds_per_item(angles.size(), PASSES, [&]{
+						for (std::size_t i = 0; i < angles.size(); i += 1) {
+							reference_sines[i] = std::sin(angles[i]);
+							reference_cosines[i] = std::cos(angles[i]);
+						}
+					});
+
+					double fast = Benchmark::nanoseconds_per_item(angles.size(), PASSES, [&]{
+						fast_sin_cos(angles.data(), sines.data(), cosines.data(), angles.size());
+					});
+
+					examiner << "std::sin and std::cos took " << standard << "ns, fast_sin_cos took " << fast << "ns per angle" << std::endl;
+				}
+			},
+
+			{"Arc Cosine",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<float> values, angles;
+
+					for (float x = -1; x <= 1; x += 1.0f / 65536)
+						values.push_back(x);
+
+					angles.resize(values.size());
+					fast_acos(values.data(), angles.data(), values.size());
+
+					Errors scalar, batch;
+
+					for (std::size_t i = 0; i < values.size(); i += 1) {
+						scalar.add(fast_acos(values[i]), std::acos(double(values[i])));
+						batch.add(angles[i], std::acos(double(values[i])));
+					}
+
+					examiner << "Scalar error is " << scalar.ulp << " ULP, batch error is " << batch.ulp << " ULP" << std::endl;
+					examiner.check(scalar.ulp <= 2);
+					examiner.check(batch.ulp <= 2);
+
+					examiner << "Values outside the domain are clamped" << std::endl;
+					examiner.check(fast_acos(1.0001f) == 0);
+					examiner.check(number(fast_acos(-1.0001f)).equivalent(M_PI));
+
+					examiner << "Numbers can use the approximation" << std::endl;
+					examiner.check(number(0.5f).fast_acos().equivalent(R60));
+
+					double standard = Benchmark::nanoseconds_per_item(values.size(), PASSES, [&]{
+						for (std::size_t i = 0; i < values.size(); i += 1)
+							angles[i] = std::acos(values[i]);
+					});
+
+					double fast = Benchmark::nanoseconds_per_item(values.size(), PASSES, [&]{
+						fast_acos(values.data(), angles.data(), values.size());
+					});
+
+					examiner << "std::acos took " << standard << "ns, fast_acos took " << fast << "ns per value" << std::endl;
+				}
+			},
+
+			{"Arc Tangent",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<float> y, x, angles;
+
+					// Points on circles with radii from 1e-3 to 1e3, including the axes:
+					for (std::size_t i = 0; i < 4096; i += 1) {
+						double angle = (M_PI * 2 * i) / 4096 - M_PI;
+
+						for (double radius = 1e-3; radius < 1e3; radius *= 3.7) {
+							y.push_back(radius * std::sin(angle));
+							x.push_back(radius * std::cos(angle) * 1.3);
+						}
+					}
+
+					angles.resize(y.size());
+					fast_atan2(y.data(), x.data(), angles.data(), y.size());
+
+					Errors scalar, batch;
+
+					for (std::size_t i = 0; i < y.size(); i += 1) {
+						scalar.add(fast_atan2(y[i], x[i]), std::atan2(double(y[i]), double(x[i])));
+						batch.add(angles[i], std::atan2(double(y[i]), double(x[i])));
+					}
+
+					examiner << "Scalar error is " << scalar.ulp << " ULP, batch error is " << batch.ulp << " ULP" << std::endl;
+					examiner.check(scalar.ulp <= 4);
+					examiner.check(batch.ulp <= 4);
+
+					examiner << "The axes and origin are handled" << std::endl;
+					examiner.check(fast_atan2(0.0f, 0.0f) == 0);
+					examiner.check(fast_atan2(0.0f, 1.0f) == 0);
+					examiner.check(number(fast_atan2(1.0f, 0.0f)).equivalent(M_PI_2));
+					examiner.check(number(fast_atan2(0.0f, -1.0f)).equivalent(M_PI));
+					examiner.check(number(fast_atan2(-1.0f, 0.0f)).equivalent(-M_PI_2));
+
+					double standard = Benchmark::nanoseconds_per_item(y.size(), PASSES, [&]{
+						for (std::size_t i = 0; i < y.size(); i += 1)
+							angles[i] = std::atan2(y[i], x[i]);
+					});
+
+					double fast = Benchmark::nanoseconds_per_item(y.size(), PASSES, [&]{
+						fast_atan2(y.data(), x.data(), angles.data(), y.size());
+					});
+
+					examiner << "std::atan2 took " << standard << "ns, fast_atan2 took " << fast << "ns per point" << std::endl;
+				}
+			},
+
+			{"Radians",
+				[](UnitTest::Examiner & examiner) {
+					Radians<float> angle = R30;
+
+					examiner << "Fast approximations can be used for angles" << std::endl;
+					examiner.check(angle.fast_sin().equivalent(0.5));
+					examiner.check(angle.fast_cos().equivalent(angle.cos()));
+					examiner.check(angle.fast_tan().equivalent(angle.tan()));
+
+					float sine, cosine;
+					angle.fast_sin_cos(sine, cosine);
+
+					examiner.check(number(sine).equivalent(0.5));
+					examiner.check(number(cosine).equivalent(angle.cos()));
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,110 @@
+
+#include <UnitTest/UnitTest.hpp>
+
+#include <Euclid/Numerics/VectorArray.hpp>
+#include <Euclid/Numerics/Vector.Geometry.hpp>
+#include <Euclid/Numerics/Vector.IO.hpp>
+
+namespace Euclid
+{
+	namespace Numerics
+	{
+		UnitTest::Suite VectorArrayTestSuite {
+			"Euclid::Numerics::VectorArray",
+
+			{"Conversion",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<Vec3> vectors = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+					Vec3Array array = vectors;
+
+					examiner.check_equal(array.size(), 3);
+					examiner.check_equal(array[1], Vec3{4, 5, 6});
+
+					examiner << "Components are stored in separate lanes." << std::endl;
+					examiner.check_equal(array.lane(Y)[2], 8);
+
+					std::vector<Vec3> copy = array;
+					examiner.check(copy == vectors);
+				}
+			},
+
+			{"Arithmetic",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<Vec3> vectors;
+
+					// An odd number of vectors exercises both the wide and scalar paths:
+					for (std::size_t i = 0; i < 19; i += 1)
+						vectors.push_back({RealT(i), RealT(i) * 2, RealT(i) * 3});
+
+					Vec3Array a = vectors, b = vectors, result;
+
+					add(result, a, b);
+					examiner.check_equal(result[11], vectors[11] + vectors[11]);
+
+					subtract(result, a, b);
+					examiner.check_equal(result[18], Vec3(ZERO));
+
+					multiply(result, a, 2.0f);
+					examiner.check_equal(result[17], vectors[17] * 2);
+
+					b /= 2;
+					examiner.check_equal(b[5], vectors[5] / 2);
+
+					clamp(result, a, 1.0f, 10.0f);
+					examiner.check_equal(result[0], Vec3{1, 1, 1});
+					examiner.check_equal(result[4], Vec3{4, 8, 10});
+				}
+			},
+
+			{"Geometry",
+				[](UnitTest::Examiner & examiner) {
+					std::vector<Vec3> us, vs;
+
+					for (std::size_t i = 0; i < 13; i += 1) {
+						us.push_back({RealT(i) + 1, RealT(i) * 0.5f, -RealT(i)});
+						vs.push_back({RealT(i) * 0.25f, 3, RealT(i) - 2});
+					}
+
+					us[7] = ZERO;
+
+					Vec3Array u = us, v = vs, result;
+					VectorArray<1, RealT> scalars;
+
+					dot(scalars, u, v);
+					examiner << "Dot product is correct." << std::endl;
+					examiner.check(us[3].dot(vs[3]).equivalent(scalars.lane(0)[3]));
+
+					length(scalars, u);
+					examiner << "Length is correct." << std::endl;
+					examiner.check(us[12].length().equivalent(scalars.lane(0)[12]));
+
+					cross_product(result, u, v);
+					examiner << "Cross product is correct." << std::endl;
+					examiner.check(result[9].equivalent(cross_product(us[9], vs[9])));
+
+					normalize(result, u);
+					examiner << "Normalized vectors are correct." << std::endl;
+					examiner.check(result[10].equivalent(us[10].normalize()));
+
+					examiner << "Zero length vectors are unchanged." << std::endl;
+					examiner.check_equal(result[7], Vec3(ZERO));
+				}
+			},
+
+			{"Double Precision",
+				[](UnitTest::Examiner & examiner) {
+					VectorArray<2, double> a;
+
+					for (std::size_t i = 0; i < 7; i += 1)
+						a.push_back({double(i) + 1, 1});
+
+					VectorArray<1, double> lengths;
+					length_squared(lengths, a);
+
+					examiner.check_equal(lengths.lane(0)[6], 50.0);
+				}
+			},
+		};
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef _EUCLID_TEST_OBJECTS_H
+#define _EUCLID_TEST_OBJECTS_H
+
+#include <Euclid/Geometry/AlignedBox.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Euclid
+{
+	namespace Geometry
+	{
+		// Objects for the spatial partitioning test cases:
+		namespace
+		{
+			// An object in a world, which is ordered by its identity rather than its position:
+			struct Object
+			{
+				std::size_t identity;
+				AlignedBox3 box;
+
+				AlignedBox3 bounding_box () const { return box; }
+
+				bool operator== (const Object & other) const { return identity == other.identity; }
+				bool operator< (const Object & other) const { return identity < other.identity; }
+			};
+
+			// Boxes scattered through a cube, which are small unless a larger maximum size is given:
+			std::vector<Object> random_objects (std::size_t count, RealT extent, RealT maximum_size = 2)
+			{
+				std::mt19937 rng(5);
+				std::uniform_real_distribution<RealT> position(0, extent - maximum_size), size(0.1, maximum_size);
+
+				std::vector<Object> objects(count);
+
+				for (std::size_t i = 0; i < count; i += 1) {
+					Vec3 min(position(rng), position(rng), position(rng));
+					objects[i] = {i, AlignedBox3(min, min + Vec3(size(rng), size(rng), size(rng)))};
+				}
+
+				return objects;
+			}
+
+			template <typename ObjectSetT>
+			std::vector<Object> sorted (const ObjectSetT & objects)
+			{
+				std::vector<Object> result(objects.begin(), objects.end());
+				std::sort(result.begin(), result.end());
+
+				return result;
+			}
+		}
+	}
+}
+
+#endif